@@ -0,0 +1,154 @@
+/* ============================================================================
+ * I B E X - bench_centered_form.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+/*
+ * Microbenchmark of centeredFormEval.
+ *
+ * For each SIC of each Minibex file given on the command line (typically
+ * the files of benchs/optim/siptestset), random sub-boxes of the initial box are
+ * evaluated with the reference implementation (interval arithmetic for the
+ * linear terms) and with the current one (raw double kernel). Usage:
+ *
+ *   bench-centered-form [--universal REGEX] [--boxes N] file.mbx...
+ */
+
+#include "ibex_IntervalKernel.h"
+#include "ibex_SIPSystem.h"
+#include "ibex_utils.h"
+
+#include "ibex_Function.h"
+#include "ibex_Interval.h"
+#include "ibex_IntervalVector.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+// centeredFormEval before the raw double kernel
+Interval reference_centered_form_eval(const Function& function, const IntervalVector& arg) {
+	IntervalVector new_arg_ub(arg);
+	IntervalVector new_arg_lb(arg);
+	IntervalVector grad = function.gradient(arg);
+	for(int i = 0; i < arg.size(); ++i) {
+		if(grad[i].lb() > 0) {
+			new_arg_ub[i] = arg[i].ub();
+			new_arg_lb[i] = arg[i].lb();
+		} else if(grad[i].ub() < 0) {
+			new_arg_ub[i] = arg[i].lb();
+			new_arg_lb[i] = arg[i].ub();
+		}
+	}
+	Interval natural_extension = function.eval(arg);
+	Interval centered_form = function.eval(arg.mid()) + grad * (arg - arg.mid());
+	Interval ub_form = function.eval(arg.ub()) + grad * (arg - arg.ub());
+	Interval lb_form = function.eval(arg.lb()) + grad * (arg - arg.lb());
+	Interval res = natural_extension & centered_form & ub_form & lb_form;
+	res &= Interval(function.eval(new_arg_lb).lb(), function.eval(new_arg_ub).ub());
+	return res;
+}
+
+IntervalVector random_sub_box(const IntervalVector& box, mt19937& rng) {
+	uniform_real_distribution<double> uniform(0, 1);
+	IntervalVector res(box.size());
+	for (int i = 0; i < box.size(); ++i) {
+		// Unbounded domains are restricted to [-10,10]
+		const Interval domain = box[i] & Interval(-10, 10);
+		const double a = domain.lb() + uniform(rng) * domain.diam();
+		const double b = domain.lb() + uniform(rng) * domain.diam();
+		res[i] = Interval(std::min(a, b), std::max(a, b));
+	}
+	return res;
+}
+
+template<typename F>
+double time_ms(F f) {
+	const auto start = chrono::steady_clock::now();
+	f();
+	return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+}
+
+int main(int argc, const char** argv) {
+	regex universal("y.*", regex_constants::egrep);
+	int nb_boxes = 10000;
+	vector<string> files;
+	for (int i = 1; i < argc; ++i) {
+		const string arg(argv[i]);
+		if (arg == "--universal" && i + 1 < argc) {
+			universal = regex(argv[++i], regex_constants::egrep);
+		} else if (arg == "--boxes" && i + 1 < argc) {
+			nb_boxes = atoi(argv[++i]);
+		} else {
+			files.push_back(arg);
+		}
+	}
+	if (files.empty()) {
+		cerr << "usage: " << argv[0] << " [--universal REGEX] [--boxes N] file.mbx..." << endl;
+		return 1;
+	}
+
+	cout << "kernel: " << centered_forms_kernel_isa() << endl;
+	cout << "file\tsic\tn\treference (ms)\tkernel (ms)\tspeedup\tmean width ratio" << endl;
+	mt19937 rng(0);
+	double total_reference = 0;
+	double total_kernel = 0;
+	for (const string& file : files) {
+		SIPSystem sys(file, universal);
+		const IntervalVector x_box = sys.extractInitialBox();
+		for (int c = 0; c < sys.sic_constraints_.size(); ++c) {
+			const SIConstraint& sic = sys.sic_constraints_[c];
+			const Function& function = *sic.function_;
+			IntervalVector full_box(function.nb_var());
+			full_box.put(0, x_box.subvector(0, sic.variable_count_-1));
+			full_box.put(sic.variable_count_, sys.initial_parameter_boxes_[c]);
+			vector<IntervalVector> boxes;
+			for (int k = 0; k < nb_boxes; ++k) {
+				boxes.push_back(random_sub_box(full_box, rng));
+			}
+			vector<Interval> reference(nb_boxes);
+			vector<Interval> kernel(nb_boxes);
+			const double reference_time = time_ms([&]() {
+				for (int k = 0; k < nb_boxes; ++k) {
+					reference[k] = reference_centered_form_eval(function, boxes[k]);
+				}
+			});
+			const double kernel_time = time_ms([&]() {
+				for (int k = 0; k < nb_boxes; ++k) {
+					kernel[k] = centeredFormEval(function, boxes[k]);
+				}
+			});
+			double width_ratio = 0;
+			int nb_ratios = 0;
+			for (int k = 0; k < nb_boxes; ++k) {
+				if (reference[k].diam() > 0 && !reference[k].is_unbounded()) {
+					width_ratio += kernel[k].diam() / reference[k].diam();
+					++nb_ratios;
+				}
+			}
+			total_reference += reference_time;
+			total_kernel += kernel_time;
+			cout << file << "\t" << c << "\t" << function.nb_var() << "\t" << reference_time << "\t" << kernel_time
+					<< "\t" << reference_time / kernel_time << "\t"
+					<< (nb_ratios > 0 ? width_ratio / nb_ratios : 1.0) << endl;
+		}
+	}
+	cout << "total\t\t\t" << total_reference << "\t" << total_kernel << "\t" << total_reference / total_kernel << endl;
+	return 0;
+}
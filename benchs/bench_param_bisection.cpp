@@ -0,0 +1,100 @@
+/* ============================================================================
+ * I B E X - bench_param_bisection.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+/*
+ * Benchmark of the parameter bisection policies (see ParameterBisector).
+ *
+ * For each SIC with at least two parameters of each Minibex file given on the
+ * command line (typically the files of benchs/optim/siptestset), the paving of
+ * the SIC is refined at the midpoint of the initial box, as in blankenship():
+ * bisection of the paving followed by simplify_paving, for a number of rounds.
+ * For each policy, the final and peak paving sizes, the time and the upper
+ * bound of the SIC on the final paving are reported. Usage:
+ *
+ *   bench-param-bisection [--universal REGEX] [--rounds N] file.mbx...
+ */
+
+#include "ibex_ParameterBisector.h"
+#include "ibex_SICPaving.h"
+#include "ibex_SIPSystem.h"
+
+#include "ibex_Interval.h"
+#include "ibex_IntervalVector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace ibex;
+
+int main(int argc, const char** argv) {
+	regex universal("y.*", regex_constants::egrep);
+	int rounds = 6;
+	vector<string> files;
+	for (int i = 1; i < argc; ++i) {
+		const string arg(argv[i]);
+		if (arg == "--universal" && i + 1 < argc) {
+			universal = regex(argv[++i], regex_constants::egrep);
+		} else if (arg == "--rounds" && i + 1 < argc) {
+			rounds = atoi(argv[++i]);
+		} else {
+			files.push_back(arg);
+		}
+	}
+	if (files.empty()) {
+		cerr << "usage: " << argv[0] << " [--universal REGEX] [--rounds N] file.mbx..." << endl;
+		return 1;
+	}
+
+	const vector<pair<string, ParameterBisector::Policy>> policies = {
+			{ "all", ParameterBisector::all_dims },
+			{ "largest", ParameterBisector::largest_first },
+			{ "smear", ParameterBisector::smear },
+			{ "rr", ParameterBisector::round_robin } };
+
+	cout << "file\tsic\tp\tpolicy\tfinal size\tpeak size\ttime (ms)\tub" << endl;
+	for (const string& file : files) {
+		SIPSystem sys(file, universal);
+		const IntervalVector init_box = sys.extractInitialBox();
+		for (int c = 0; c < sys.sic_constraints_.size(); ++c) {
+			const SIConstraint& sic = sys.sic_constraints_[c];
+			if (sic.parameter_count_ < 2) {
+				continue;
+			}
+			// Unbounded domains are restricted to [-10,10]
+			const IntervalVector x_box = init_box.subvector(0, sic.variable_count_-1)
+					& IntervalVector(sic.variable_count_, Interval(-10, 10));
+			const IntervalVector x(x_box.mid());
+			for (const auto& policy : policies) {
+				const ParameterBisector bisector(sic.variable_count_, policy.second);
+				SIConstraintCache cache((*sys.getInitialNodeCaches())[c]);
+				int peak_size = 0;
+				const auto start = chrono::steady_clock::now();
+				simplify_paving(sic, cache, x, true);
+				for (int r = 0; r < rounds; ++r) {
+					bisect_paving(cache, bisector);
+					peak_size = std::max(peak_size, cache.parameter_caches_.size());
+					simplify_paving(sic, cache, x, true);
+				}
+				const double time = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+				cache.update_cache(*sic.function_, x, true);
+				cout << file << "\t" << c << "\t" << sic.parameter_count_ << "\t" << policy.first << "\t"
+						<< cache.parameter_caches_.size() << "\t" << peak_size << "\t" << time << "\t"
+						<< cache.eval_cache_.ub() << endl;
+			}
+		}
+	}
+	return 0;
+}
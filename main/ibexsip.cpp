@@ -62,6 +62,9 @@ int main(int argc, const char ** argv) {
 	args::ValueFlag<long> random_seed(parser, "float", _random_seed.str(), { "random-seed" }, default_random_seed);
 	args::ValueFlag<regex> quantified_params(parser, "string", "Specify universally quantified parameters with egrep syntax", {
 			"universal" }, regex());
+	args::ValueFlag<int> llp_threads(parser, "int",
+			"Number of threads solving the lower-level problems of the constraints (with several threads, the sampled values may differ from a sequential run). Default value is 1.",
+			{ "llp-threads" }, 1);
 	args::Flag trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.",
 			{ "trace" });
 	args::Flag format(parser, "format", "Display the output format in quiet mode", { "format" });
@@ -237,6 +240,13 @@ int main(int argc, const char ** argv) {
 				cout << "  random seed:\t" << random_seed.Get() << endl;
 		}
 
+		if (llp_threads.Get() < 1) {
+			ibex_error("the number of LLP threads must be positive");
+		}
+		sip.nb_threads = llp_threads.Get();
+		if (!quiet && llp_threads.Get() > 1)
+			cout << "  LLP threads:\t" << llp_threads.Get() << endl;
+
 		// This option prints each better feasible point when it is found
 		if (trace) {
 			if (!quiet)
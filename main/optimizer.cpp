@@ -14,16 +14,23 @@
 #include "ibex_CtcBisectActiveParameters.h"
 #include "ibex_CtcFirstOrderTest.h"
 #include "ibex_CtcHC4SIP.h"
+#include "ibex_CutPool.h"
+#include "ibex_ParameterPointPool.h"
 #include "ibex_GoldsztejnSICBisector.h"
 #include "ibex_LoupFinderLineSearch.h"
 #include "ibex_LoupFinderRestrictionsRelax.h"
 #include "ibex_LoupFinderSIPDefault.h"
 #include "ibex_LoupFinderCompo.h"
 #include "ibex_CellDoubleHeapSIP.h"
+#include "ibex_CellSpillingHeapSIP.h"
+#include "ibex_CellWorkStealingHeap.h"
 #include "ibex_MinibexOptionsParser.h"
+#include "ibex_ParameterBisector.h"
+#include "ibex_PavingThreadPool.h"
 #include "ibex_SIPOptimizer.h"
 #include "ibex_RelaxationLinearizerSIP.h"
 #include "ibex_RestrictionLinearizerSIP.h"
+#include "ibex_SIConstraintCache.h"
 #include "ibex_SIPSystem.h"
 
 #include "args.hxx"
@@ -39,10 +46,13 @@
 #include "ibex_LargestFirst.h"
 #include "ibex_Optimizer.h"
 
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
+#include <exception>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace std;
@@ -62,6 +72,192 @@ struct ValueReader<std::regex> {
 };
 }
 
+namespace {
+
+/**
+ * Options of the contractors and loup finders.
+ */
+struct StrategyOptions {
+	bool propag;
+	bool outer_lin;
+	bool first_order;
+	bool ls_corner;
+	bool ls_stein;
+	bool ls_concurrent;
+	/* Keep the outer-approximation cuts between nodes, in a pool per search thread */
+	bool cut_pool;
+};
+
+/**
+ * Contractor and loup finders of one search thread.
+ */
+struct SearchStrategy {
+	Ctc* ctc;
+	LoupFinderSIP* loup_finder;
+	LoupFinderSIP* loup_finder2;
+	CtcFilterSICParameters* sic_filter;
+	CtcFilterSICParameters* sic_filter2;
+	/* Pool of the outer linearization, nullptr if not used */
+	CutPool* cut_pool;
+};
+
+SearchStrategy build_strategy(const SIPSystem& sys, const StrategyOptions& options) {
+	std::set<LoupFinderLineSearch::InnerPointStrategy> strategies1;
+	std::set<LoupFinderLineSearch::InnerPointStrategy> strategies2;
+	if(options.ls_corner) {
+		strategies1.emplace(LoupFinderLineSearch::CORNER);
+		strategies2.emplace(LoupFinderLineSearch::CORNER);
+
+	}
+	if(options.ls_stein) {
+		strategies1.emplace(LoupFinderLineSearch::STEIN);
+		strategies2.emplace(LoupFinderLineSearch::STEIN);
+	}
+	if(options.ls_corner && options.ls_stein) {
+		strategies1.emplace(LoupFinderLineSearch::MIDPOINT);
+	}
+	strategies2.emplace(LoupFinderLineSearch::MIDPOINT);
+		
+	SearchStrategy strategy;
+	strategy.cut_pool = nullptr;
+	LoupFinderLineSearch* loup_finder = new LoupFinderLineSearch(sys, strategies1);
+	LoupFinderLineSearch* loup_finder2 = new LoupFinderLineSearch(sys, strategies2);
+	loup_finder->concurrent = options.ls_concurrent;
+	loup_finder2->concurrent = options.ls_concurrent;
+	strategy.loup_finder = loup_finder;
+	strategy.loup_finder2 = loup_finder2;
+
+	/**
+	 * Contractors:
+	 *   - GSicBisector
+	 *   - FilterSICParameters
+	 *   - HC4
+	 *   - FixPoint
+	 *   	- HC4
+	 *   	- PolytopeHull
+	 *   	- GSicBisector
+	 *   	- FilterSICParameters
+	 *   - Evaluation
+	 *   - FirstOrder
+	 *
+	 */
+
+	GoldsztejnSICBisector* sic_bisector = new GoldsztejnSICBisector(sys);
+	CtcBisectActiveParameters* ctc_bisect_active = new CtcBisectActiveParameters(sys);
+	strategy.sic_filter = new CtcFilterSICParameters(sys);
+	GoldsztejnSICBisector* sic_bisector2 = new GoldsztejnSICBisector(sys);
+	strategy.sic_filter2 = new CtcFilterSICParameters(sys);
+	CtcEvaluation* evaluation = new CtcEvaluation(sys);
+
+	// FixPoint
+	vector<Ctc*> fixpoint_list;
+	if (options.propag) {
+		CtcHC4SIP* hc4_2 = new CtcHC4SIP(sys, 0.1, true);
+		fixpoint_list.emplace_back(hc4_2);
+	}
+	if (options.outer_lin) {
+		RelaxationLinearizerSIP* relax = new RelaxationLinearizerSIP(sys,
+				RelaxationLinearizerSIP::CornerPolicy::random, true);
+		// A pool shared by the threads would make the search depend on their timing
+		if (options.cut_pool) {
+			strategy.cut_pool = new CutPool();
+		}
+		relax->set_cut_pool(strategy.cut_pool);
+		CtcPolytopeHull* ph = new ibex::CtcPolytopeHull(*relax, 1000000, 10000);
+		fixpoint_list.emplace_back(ph);
+	}
+	fixpoint_list.emplace_back(sic_bisector2);
+	fixpoint_list.emplace_back(strategy.sic_filter2);
+	fixpoint_list.emplace_back(ctc_bisect_active);
+	/*if (!no_blankenship) {
+		CtcBlankenship* blankenship = new CtcBlankenship(sys, 0.1, 1000);
+		fixpoint_list.emplace_back(blankenship);
+	}*/
+	CtcCompo* compo = new CtcCompo(fixpoint_list);
+	CtcFixPoint* fixpoint = new CtcFixPoint(*compo, 0.1); // Best: 0.1
+
+	vector<Ctc*> ctc_list;
+	ctc_list.emplace_back(sic_bisector);
+	ctc_list.emplace_back(strategy.sic_filter);
+	if (options.propag) {
+		CtcHC4SIP* hc4 = new CtcHC4SIP(sys, 0.1, true);
+		ctc_list.emplace_back(hc4);
+	}
+	ctc_list.emplace_back(fixpoint);
+	ctc_list.emplace_back(evaluation);
+	if (options.first_order) {
+		CtcFirstOrderTest* firstordertest = new CtcFirstOrderTest(sys);
+		ctc_list.push_back(firstordertest);
+	}
+	strategy.ctc = new CtcCompo(ctc_list);
+	return strategy;
+}
+
+/**
+ * Objects of one member of a portfolio, besides the first one (built on the
+ * system of the command line).
+ */
+struct PortfolioMember {
+	SIPSystem* sys;
+	CellBufferOptim* buffer;
+	RoundRobin* bisector;
+	SearchStrategy strategy;
+	SIPOptimizer* optimizer;
+	std::string description;
+};
+
+/**
+ * Configuration of the k-th member of a portfolio. The member 0 uses the
+ * options of the command line and a single buffer criterion, the other ones
+ * cycle through variants of them. All the members have their own seed.
+ */
+void portfolio_variant(int k, StrategyOptions& options, int& crit2_pr, std::string& description) {
+	crit2_pr = 0;
+	description = "command line options";
+	switch (k % 4) {
+	case 1:
+		options.propag = !options.propag;
+		crit2_pr = 50;
+		description = options.propag ? "with propagation" : "without propagation";
+		break;
+	case 2:
+		options.ls_corner = true;
+		options.ls_stein = false;
+		crit2_pr = 20;
+		description = "corner line search";
+		break;
+	case 3:
+		options.ls_corner = false;
+		options.ls_stein = true;
+		crit2_pr = 80;
+		description = "Stein line search";
+		break;
+	}
+	if (crit2_pr > 0) {
+		description += ", UB criterion " + std::to_string(crit2_pr) + "%";
+	}
+}
+
+PortfolioMember build_member(const SIPSystem& sys, const StrategyOptions& base_options, long random_seed, int k,
+		double eps_x, double rel_eps_f, double abs_eps_f) {
+	PortfolioMember member;
+	StrategyOptions options = base_options;
+	int crit2_pr;
+	portfolio_variant(k, options, crit2_pr, member.description);
+	// ibex Functions are not reentrant: each member works on its own copy of the system
+	member.sys = sys.clone();
+	member.sys->seed(random_seed + k);
+	member.buffer = new CellDoubleHeapSIP(*member.sys, crit2_pr);
+	member.bisector = new RoundRobin(0);
+	member.strategy = build_strategy(*member.sys, options);
+	member.optimizer = new SIPOptimizer(member.sys->nb_var, *member.strategy.ctc, *member.bisector,
+			*member.strategy.loup_finder, *member.strategy.loup_finder2, *member.buffer, member.sys->nb_var, eps_x,
+			rel_eps_f, abs_eps_f);
+	return member;
+}
+
+} // end namespace
+
 int main(int argc, const char ** argv) {
 	const long default_random_seed = 0L;
 	stringstream _rel_eps_f, _abs_eps_f, _eps_h, _random_seed, _eps_x;
@@ -94,10 +290,51 @@ int main(int argc, const char ** argv) {
 	args::Flag no_outer_lin(parser, "no-outer-linearizations", "Deactivate outer linearizations",
 			{ 'o', "no-outer-lin" });
 	
+	args::Flag no_cut_pool(parser, "no-cut-pool",
+			"Regenerate the outer linearizations at each node instead of reusing the cuts of the parent nodes",
+			{ "no-cut-pool" });
+	args::Flag no_presolve(parser, "no-presolve",
+			"Keep the SICs as they are, without fixing the monotone parameters nor bounding the separable terms",
+			{ "no-presolve" });
+	args::Flag no_incremental_cache(parser, "no-incremental-cache",
+			"Evaluate the SICs on the whole parameter paving at each node instead of updating the evaluations of the parent node",
+			{ "no-incremental-cache" });
+	args::Flag no_point_pool(parser, "no-point-pool",
+			"Do not share the worst-case parameters found in a node with the other nodes", { "no-point-pool" });
 	args::Flag no_first_order(parser, "no-first-order-test", "Deactivate first order test", { 'f', "no-first-order" });
 	//args::Flag no_blankenship(parser, "no-blankenship", "Deactivate Blankenship heuristic", { 'b', "no-blankenship" });
 	args::Flag no_ls_stein(parser, "no-ls-stein", "Deactivate Stein strategy in line search", {"no-ls-stein" });
 	args::Flag no_ls_corner(parser, "no-ls-corner", "Deactivate corner restrictions in line search", {"no-ls-corner" });
+	args::Flag ls_concurrent(parser, "ls-concurrent",
+			"Run the line search strategies concurrently, each one on its own thread. Not compatible with --threads.",
+			{"ls-concurrent" });
+	args::ValueFlag<std::string> param_bisection(parser, "string",
+			"Bisection of parameter boxes: all (all dimensions), largest (largest first), smear or rr (round-robin). Default value is all.",
+			{ "param-bisection" }, "all");
+	args::ValueFlag<int> threads(parser, "int", "Number of search threads. Default value is 1.", { "threads" }, 1);
+	args::Flag deterministic(parser, "deterministic",
+			"Make the multi-threaded search reproducible (the loup is shared between threads once per round).",
+			{ "deterministic" });
+	args::ValueFlag<int> portfolio(parser, "int",
+			"Number of configurations solving the problem concurrently (seeds, line search strategies, propagation, buffer criteria). They share the loup and stop when one of them reaches the precision. Default value is 1.",
+			{ "portfolio" }, 1);
+	args::ValueFlag<int> paving_threads(parser, "int",
+			"Number of threads sweeping the parameter pavings of a node. Default value is 1.", { "paving-threads" }, 1);
+	args::ValueFlag<int> paving_threshold(parser, "int",
+			"Minimal number of parameter boxes of a parallel paving sweep. Default value is 256.",
+			{ "paving-threshold" }, PavingThreadPool::default_threshold);
+	args::ValueFlag<double> memory_limit(parser, "float",
+			"Memory of the open cells (in MB). Beyond it, the least promising cells are moved to a temporary file. Not compatible with --checkpoint. Default value is +oo.",
+			{ "memory-limit" });
+	args::ValueFlag<std::string> spill_dir(parser, "string",
+			"Directory of the temporary file of --memory-limit. Default value is $TMPDIR or /tmp.", { "spill-dir" });
+	args::ValueFlag<std::string> checkpoint(parser, "filename",
+			"Periodically write the open cells, the loup and the uplo in a checkpoint file (see --resume). The search only pauses to take copy-on-write snapshots of the open cells, a background thread serializes and writes them.",
+			{ "checkpoint" });
+	args::ValueFlag<double> checkpoint_period(parser, "float",
+			"Time between two checkpoints (in seconds). Default value is 600.", { "checkpoint-period" }, 600);
+	args::ValueFlag<std::string> resume(parser, "filename",
+			"Restart the search from a checkpoint file written by --checkpoint on the same problem.", { "resume" });
 	args::Flag trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.",
 			{ "trace" });
 	args::Flag format(parser, "format", "Display the output format in quiet mode", { "format" });
@@ -152,8 +389,10 @@ int main(int argc, const char ** argv) {
 	}
 
 	std::vector<std::string> accepted_options = { "--rel-eps-f", "--abs-eps-f", "--timeout", "--random-seed", "--eps-x",
-			"--initial-loup", "--no-propag", "--no-outer-lin", "--no-inner-lin", "--no-first-order",
-			"--no-line-search", "--trace", "--universal" };
+			"--initial-loup", "--no-propag", "--no-outer-lin", "--no-inner-lin", "--no-first-order", "--no-cut-pool",
+			"--no-point-pool", "--no-incremental-cache", "--no-presolve", "--no-line-search", "--trace", "--universal", "--param-bisection",
+			"--threads", "--deterministic", "--paving-threads", "--paving-threshold", "--ls-concurrent", "--portfolio",
+			"--checkpoint", "--checkpoint-period", "--resume", "--memory-limit", "--spill-dir" };
 	MinibexOptionsParser minibexParser(accepted_options);
 	minibexParser.parse(filename.Get());
 	vector<string> unsupported_options = minibexParser.unsupported_options();
@@ -191,8 +430,11 @@ int main(int argc, const char ** argv) {
 	}
 	try {
 
+		// The caches of the SICs are created with the system
+		SIConstraintCache::default_incremental = !no_incremental_cache;
+
 		// Load a system of equations
-		SIPSystem sys(filename.Get().c_str(), quantified_params.Get());
+		SIPSystem sys(filename.Get().c_str(), quantified_params.Get(), !no_presolve);
 
 		if (!sys.goal_function_) {
 			ibex::ibex_error(" input file has not goal (it is not an optimization problem).");
@@ -201,6 +443,13 @@ int main(int argc, const char ** argv) {
 		if (!quiet) {
 			cout << endl << "************************ setup ************************" << endl;
 			cout << "  file loaded:\t" << filename.Get() << endl;
+			if (sys.nb_fixed_parameters > 0 || sys.nb_separable_constraints > 0) {
+				cout << "  presolve:\t" << sys.nb_fixed_parameters << " monotone parameter(s) fixed, "
+						<< sys.nb_separable_constraints << " separable SIC(s) bounded" << endl;
+			}
+			if (no_incremental_cache) {
+				cout << "  SIC caches:\tfull evaluation at each node" << endl;
+			}
 		}
 
 		if (rel_eps_f) {
@@ -257,95 +506,102 @@ int main(int argc, const char ** argv) {
 		 */
 
 		srand(random_seed.Get());
+		sys.seed(random_seed.Get());
 
-		//BxpNodeData::sip_system = &sys;
+		ParameterBisector::default_policy = ParameterBisector::parse_policy(param_bisection.Get());
+		if (!quiet && param_bisection)
+			cout << "  parameter bisection:\t" << param_bisection.Get() << endl;
 
-		CellDoubleHeapSIP buffer = CellDoubleHeapSIP(sys, 0);
-		ibex::RoundRobin bisector = ibex::RoundRobin(0);
-		/*Vector prec(sys.ext_nb_var, 1e-20);
-		prec[sys.ext_nb_var - 1] = POS_INFINITY;
-		LargestFirst bisector(prec);*/
-		std::set<LoupFinderLineSearch::InnerPointStrategy> strategies1;
-		std::set<LoupFinderLineSearch::InnerPointStrategy> strategies2;
-		if(!no_ls_corner) {
-			strategies1.emplace(LoupFinderLineSearch::CORNER);
-			strategies2.emplace(LoupFinderLineSearch::CORNER);
+		//BxpNodeData::sip_system = &sys;
 
+		if (threads.Get() < 1) {
+			ibex::ibex_error("the number of threads must be positive");
 		}
-		if(!no_ls_stein) {
-			strategies1.emplace(LoupFinderLineSearch::STEIN);
-			strategies2.emplace(LoupFinderLineSearch::STEIN);
+		if (portfolio.Get() < 1) {
+			ibex::ibex_error("the number of portfolio members must be positive");
 		}
-		if(!no_ls_corner && !no_ls_stein) {
-			strategies1.emplace(LoupFinderLineSearch::MIDPOINT);
+		if (portfolio.Get() > 1 && threads.Get() > 1) {
+			ibex::ibex_error("--portfolio and --threads cannot be combined (each member has a single search thread)");
 		}
-		strategies2.emplace(LoupFinderLineSearch::MIDPOINT);
-			
-		LoupFinderSIP *loup_finder = new LoupFinderLineSearch(sys, strategies1);
-		LoupFinderSIP *loup_finder2 = new LoupFinderLineSearch(sys, strategies2);
-
-		/**
-		 * Contractors:
-		 *   - GSicBisector
-		 *   - FilterSICParameters
-		 *   - HC4
-		 *   - FixPoint
-		 *   	- HC4
-		 *   	- PolytopeHull
-		 *   	- GSicBisector
-		 *   	- FilterSICParameters
-		 *   - Evaluation
-		 *   - FirstOrder
-		 *
-		 */
-
-		GoldsztejnSICBisector* sic_bisector = new GoldsztejnSICBisector(sys);
-		CtcBisectActiveParameters* ctc_bisect_active = new CtcBisectActiveParameters(sys);
-		CtcFilterSICParameters* sic_filter = new CtcFilterSICParameters(sys);
-		GoldsztejnSICBisector* sic_bisector2 = new GoldsztejnSICBisector(sys);
-		CtcFilterSICParameters* sic_filter2 = new CtcFilterSICParameters(sys);
-		CtcEvaluation* evaluation = new CtcEvaluation(sys);
-
-		// FixPoint
-		vector<Ctc*> fixpoint_list;
-		if (!no_propag) {
-			CtcHC4SIP* hc4_2 = new CtcHC4SIP(sys, 0.1, true);
-			fixpoint_list.emplace_back(hc4_2);
+		if (ls_concurrent && threads.Get() > 1) {
+			ibex::ibex_error("--ls-concurrent and --threads cannot be combined (the search threads would share the cores with the strategies)");
+		}
+		if ((checkpoint || resume) && portfolio.Get() > 1) {
+			ibex::ibex_error("--checkpoint and --resume cannot be combined with --portfolio");
 		}
-		if (!no_outer_lin) {
-			RelaxationLinearizerSIP* relax = new RelaxationLinearizerSIP(sys,
-					RelaxationLinearizerSIP::CornerPolicy::random, true);
-			CtcPolytopeHull* ph = new ibex::CtcPolytopeHull(*relax, 1000000, 10000);
-			fixpoint_list.emplace_back(ph);
+		if (checkpoint && memory_limit) {
+			ibex::ibex_error("--checkpoint and --memory-limit cannot be combined (a checkpoint reads all the spilled cells back in memory)");
 		}
-		fixpoint_list.emplace_back(sic_bisector2);
-		fixpoint_list.emplace_back(sic_filter2);
-		fixpoint_list.emplace_back(ctc_bisect_active);
-		/*if (!no_blankenship) {
-			CtcBlankenship* blankenship = new CtcBlankenship(sys, 0.1, 1000);
-			fixpoint_list.emplace_back(blankenship);
-		}*/
-		CtcCompo* compo = new CtcCompo(fixpoint_list);
-		CtcFixPoint* fixpoint = new CtcFixPoint(*compo, 0.1); // Best: 0.1
-
-		vector<Ctc*> ctc_list;
-		ctc_list.emplace_back(sic_bisector);
-		ctc_list.emplace_back(sic_filter);
-		if (!no_propag) {
-			CtcHC4SIP* hc4 = new CtcHC4SIP(sys, 0.1, true);
-			ctc_list.emplace_back(hc4);
+		if (checkpoint && threads.Get() > 1 && !deterministic) {
+			ibex::ibex_error("--checkpoint requires --deterministic with several threads");
 		}
-		ctc_list.emplace_back(fixpoint);
-		ctc_list.emplace_back(evaluation);
-		if (!no_first_order) {
-			CtcFirstOrderTest* firstordertest = new CtcFirstOrderTest(sys);
-			ctc_list.push_back(firstordertest);
+
+		if (paving_threads.Get() > 1) {
+			PavingThreadPool::global().resize(paving_threads.Get());
+			PavingThreadPool::global().threshold = paving_threshold.Get();
+			if (!quiet)
+				cout << "  paving threads:\t" << paving_threads.Get() << "\t(pavings of at least "
+						<< paving_threshold.Get() << " boxes)" << endl;
 		}
-		CtcCompo* ctc = new CtcCompo(ctc_list);
 
-		LoupFinderCompo lf_compo(Array<LoupFinder>(*loup_finder, *loup_finder2));
-		SIPOptimizer optimizer(sys.nb_var, *ctc, bisector, *loup_finder, *loup_finder2, buffer, sys.nb_var,
-			eps_x.Get(), rel_eps_f.Get(), abs_eps_f.Get());
+		// Deterministic rounds are scheduled by a single thread: they keep a single heap
+		CellBufferOptim* buffer;
+		if (memory_limit) {
+			if (memory_limit.Get() <= 0) {
+				ibex::ibex_error("the memory limit must be positive");
+			}
+			// Threads running freely share it under a lock
+			buffer = new CellSpillingHeapSIP(sys, memory_limit.Get() * 1024 * 1024, spill_dir.Get());
+			if (!quiet)
+				cout << "  memory limit:\t" << memory_limit.Get() << "MB (open cells)" << endl;
+		} else if (threads.Get() > 1 && !deterministic)
+			buffer = new CellWorkStealingHeap(sys, threads.Get(), 0);
+		else
+			buffer = new CellDoubleHeapSIP(sys, 0);
+		ibex::RoundRobin bisector = ibex::RoundRobin(0);
+		/*Vector prec(sys.ext_nb_var, 1e-20);
+		prec[sys.ext_nb_var - 1] = POS_INFINITY;
+		LargestFirst bisector(prec);*/
+		StrategyOptions strategy_options;
+		strategy_options.propag = !no_propag;
+		strategy_options.outer_lin = !no_outer_lin;
+		strategy_options.first_order = !no_first_order;
+		strategy_options.ls_corner = !no_ls_corner;
+		strategy_options.ls_stein = !no_ls_stein;
+		strategy_options.ls_concurrent = ls_concurrent;
+		strategy_options.cut_pool = !no_cut_pool;
+		// Before the system is cloned: the clones share the pool
+		ParameterPointPool point_pool(sys.initial_parameter_boxes_);
+		sys.parameter_point_pool = no_point_pool ? nullptr : &point_pool;
+		if (!quiet && ls_concurrent)
+			cout << "  line search:\tconcurrent strategies" << endl;
+
+		vector<SearchStrategy> strategies;
+		strategies.emplace_back(build_strategy(sys, strategy_options));
+		SearchStrategy& strategy = strategies.front();
+
+		LoupFinderCompo lf_compo(Array<LoupFinder>(*strategy.loup_finder, *strategy.loup_finder2));
+		SIPOptimizer optimizer(sys.nb_var, *strategy.ctc, bisector, *strategy.loup_finder, *strategy.loup_finder2,
+				*buffer, sys.nb_var, eps_x.Get(), rel_eps_f.Get(), abs_eps_f.Get());
+
+		// ibex Functions are not reentrant: each extra thread works on its own copy of the system
+		vector<SIPSystem*> thread_systems;
+		vector<RoundRobin*> thread_bisectors;
+		for (int t = 1; t < threads.Get(); ++t) {
+			SIPSystem* thread_sys = sys.clone();
+			thread_sys->seed(random_seed.Get() + t);
+			thread_systems.push_back(thread_sys);
+			thread_bisectors.push_back(new RoundRobin(0));
+			strategies.emplace_back(build_strategy(*thread_sys, strategy_options));
+			optimizer.add_worker(*strategies.back().ctc, *thread_bisectors.back(), *strategies.back().loup_finder,
+					*strategies.back().loup_finder2);
+		}
+		if (threads.Get() > 1) {
+			optimizer.deterministic = deterministic;
+			optimizer.point_pool = sys.parameter_point_pool;
+			if (!quiet)
+				cout << "  threads:\t" << threads.Get() << (deterministic ? " (deterministic)" : "") << endl;
+		}
 		//Optimizer optimizer(sys.nb_var, *ctc, bisector, lf_compo, buffer, sys.nb_var);
 		// This option limits the search time
 		if (timeout) {
@@ -354,6 +610,16 @@ int main(int argc, const char ** argv) {
 			optimizer.timeout = timeout.Get();
 		}
 
+		if (checkpoint) {
+			if (!quiet)
+				cout << "  checkpoint:\t" << checkpoint.Get() << " (every " << checkpoint_period.Get() << "s)" << endl;
+			optimizer.set_checkpoint(checkpoint.Get(), checkpoint_period.Get());
+		}
+		if (resume) {
+			if (!quiet)
+				cout << "  resume from:\t" << resume.Get() << endl;
+		}
+
 		// This option prints each better feasible point when it is found
 		if (trace) {
 			if (!quiet)
@@ -367,6 +633,28 @@ int main(int argc, const char ** argv) {
 		 }
 		 */
 
+		// The members of a portfolio share the loup and the end of the search
+		SIPIncumbent portfolio_incumbent;
+		std::atomic<bool> portfolio_stop(false);
+		vector<PortfolioMember> members;
+		if (portfolio.Get() > 1) {
+			optimizer.share(portfolio_incumbent, portfolio_stop);
+			for (int k = 1; k < portfolio.Get(); ++k) {
+				members.push_back(build_member(sys, strategy_options, random_seed.Get(), k, eps_x.Get(),
+						rel_eps_f.Get(), abs_eps_f.Get()));
+				PortfolioMember& member = members.back();
+				member.optimizer->share(portfolio_incumbent, portfolio_stop);
+				member.optimizer->timeout = optimizer.timeout;
+				member.optimizer->trace = optimizer.trace;
+			}
+			if (!quiet) {
+				cout << "  portfolio:\t" << portfolio.Get() << " members" << endl;
+				for (int k = 1; k < portfolio.Get(); ++k) {
+					cout << "    member " << k << ":\t" << members[k - 1].description << endl;
+				}
+			}
+		}
+
 		if (!quiet) {
 			cout << "*******************************************************" << endl << endl;
 		}
@@ -378,17 +666,103 @@ int main(int argc, const char ** argv) {
 			cout << "running............" << endl << endl;
 
 		// Search for the optimum
-		if (initial_loup)
-			optimizer.optimize(sys.extractInitialBox(), initial_loup.Get());
-		else
-			optimizer.optimize(sys.extractInitialBox());
+		const IntervalVector init_box = sys.extractInitialBox();
+		const double init_loup = initial_loup ? initial_loup.Get() : POS_INFINITY;
+		SIPOptimizer* winner = &optimizer;
+		int winner_index = 0;
+		if (resume) {
+			optimizer.resume(init_box, resume.Get());
+		} else if (members.empty()) {
+			optimizer.optimize(init_box, init_loup);
+		} else {
+			portfolio_incumbent.reset(init_loup, init_box);
+			vector<std::exception_ptr> errors(members.size() + 1);
+			auto run = [&](SIPOptimizer& member_optimizer, int k) {
+				try {
+					member_optimizer.optimize(init_box, init_loup);
+				} catch (...) {
+					errors[k] = std::current_exception();
+					portfolio_stop = true;
+				}
+			};
+			vector<std::thread> member_threads;
+			for (int k = 1; k < portfolio.Get(); ++k) {
+				member_threads.emplace_back(run, std::ref(*members[k - 1].optimizer), k);
+			}
+			run(optimizer, 0);
+			for (std::thread& thread : member_threads) {
+				thread.join();
+			}
+			for (const std::exception_ptr& error : errors) {
+				if (error) {
+					std::rethrow_exception(error);
+				}
+			}
+			// Report the member that ended the search, otherwise the one with the best lower bound
+			for (int k = 0; k < portfolio.Get(); ++k) {
+				SIPOptimizer* member_optimizer = (k == 0) ? &optimizer : members[k - 1].optimizer;
+				const SIPOptimizer::Status status = member_optimizer->get_status();
+				if (status == SIPOptimizer::SUCCESS || status == SIPOptimizer::INFEASIBLE) {
+					winner = member_optimizer;
+					winner_index = k;
+					break;
+				}
+				if (member_optimizer->get_uplo() > winner->get_uplo()) {
+					winner = member_optimizer;
+					winner_index = k;
+				}
+			}
+		}
 
 		if (trace)
 			cout << endl;
 
 		// Report some information (computation time, etc.)
 
-		optimizer.report(!quiet);
+		winner->report(!quiet);
+		if (!quiet && !members.empty()) {
+			cout << " portfolio member reported: " << winner_index << " ("
+					<< (winner_index == 0 ? "command line options" : members[winner_index - 1].description) << ")"
+					<< endl;
+		}
+
+		CellSpillingHeapSIP* spilling_buffer = dynamic_cast<CellSpillingHeapSIP*>(buffer);
+		if (!quiet && spilling_buffer != nullptr) {
+			cout << " cells moved to disk/read back: " << spilling_buffer->nb_spilled() << "/"
+					<< spilling_buffer->nb_loaded() << endl;
+		}
+
+		if (trace) {
+			PavingFilterStats filter_stats;
+			for (const SearchStrategy& thread_strategy : strategies) {
+				filter_stats += thread_strategy.sic_filter->stats();
+				filter_stats += thread_strategy.sic_filter2->stats();
+			}
+			for (const PortfolioMember& member : members) {
+				filter_stats += member.strategy.sic_filter->stats();
+				filter_stats += member.strategy.sic_filter2->stats();
+			}
+			cout << "  parameter boxes removed by the monotonicity/evaluation/newton filters: "
+					<< filter_stats.monotonicity << "/" << filter_stats.evaluation << "/" << filter_stats.newton << endl;
+			if (strategy_options.cut_pool && strategy_options.outer_lin) {
+				long nb_cuts_added = 0;
+				long nb_cuts_selected = 0;
+				for (const SearchStrategy& thread_strategy : strategies) {
+					nb_cuts_added += thread_strategy.cut_pool->nb_added();
+					nb_cuts_selected += thread_strategy.cut_pool->nb_selected();
+				}
+				for (const PortfolioMember& member : members) {
+					nb_cuts_added += member.strategy.cut_pool->nb_added();
+					nb_cuts_selected += member.strategy.cut_pool->nb_selected();
+				}
+				cout << "  outer linearization cuts generated/reused: " << nb_cuts_added << "/" << nb_cuts_selected
+						<< endl;
+			}
+			if (sys.parameter_point_pool != nullptr) {
+				cout << "  worst-case parameters found/found again/selected: " << point_pool.nb_added() << "/"
+						<< point_pool.nb_rediscovered() << "/" << point_pool.nb_selected() << endl;
+			}
+		}
 
 		return 0;
 
@@ -13,7 +13,9 @@
 #include "ibex_CtcFilterSICParameters.h"
 #include "ibex_CtcHC4SIP.h"
 #include "ibex_GoldsztejnSICBisector.h"
+#include "ibex_ParameterBisector.h"
 #include "ibex_CellBufferNeighborhood.h"
+#include "ibex_CellWorkStealingStack.h"
 #include "ibex_MinibexOptionsParser.h"
 #include "ibex_SIPManifold.h"
 #include "ibex_SIPSolver.h"
@@ -100,6 +102,38 @@ struct ValueReader<std::regex> {
  }
  }*/
 
+/*
+ * Contractor of the solver. Each search thread builds its own on a copy of
+ * the system.
+ */
+Ctc* build_contractor(SIPSystem& system) {
+	GoldsztejnSICBisector* sic_bisector = new GoldsztejnSICBisector(system);
+	CtcFilterSICParameters* sic_filter = new CtcFilterSICParameters(system);
+
+	// FixPoint
+	vector<Ctc*> fixpoint_list;
+	CtcHC4SIP* hc4_2 = new CtcHC4SIP(system, 0.1, true);
+	fixpoint_list.emplace_back(hc4_2);
+
+	/*RelaxationLinearizerSIP* relax = new RelaxationLinearizerSIP(system,
+	 RelaxationLinearizerSIP::CornerPolicy::random, true);
+	 IbexCtcWrapper* ph = new IbexCtcWrapper(*(new ibex::CtcPolytopeHull(*relax, 1000000, 10000)));
+	 fixpoint_list.emplace_back(ph);*/
+	//CtcBlankenship* blankenship = new CtcBlankenship(system, 0.1, 1000);
+	//fixpoint_list.emplace_back(blankenship);
+	CtcCompo* compo = new CtcCompo(fixpoint_list);
+	CtcFixPoint* fixpoint = new CtcFixPoint(*compo, 0.1); // Best: 0.1
+
+	vector<Ctc*> ctc_list;
+	ctc_list.emplace_back(sic_bisector);
+	ctc_list.emplace_back(sic_filter);
+	CtcHC4SIP* hc4 = new CtcHC4SIP(system, 0.01, true);
+	ctc_list.emplace_back(hc4);
+	ctc_list.emplace_back(fixpoint);
+
+	return new CtcCompo(ctc_list);
+}
+
 int main(int argc, const char ** argv) {
 	int default_random_seed = 0;
 	double default_eps_x_min = 1e-3;
@@ -117,7 +151,7 @@ int main(int argc, const char ** argv) {
 
 	vector<string> accepted_options = { "--eps-min", "--eps-max", "--timeout", "--pp-start", "--pp-goal",
 			"--pp-heuristic", "--input", "--output", "--bfs", "--txt", "--trace", "--boundary-test", "--sols",
-			"--random-seed", "--forced-params", "--universal" };
+			"--random-seed", "--forced-params", "--universal", "--param-bisection", "--threads" };
 
 	args::ArgumentParser parser("********* SIPSolve (sipsolve) *********.", "Solve a Minibex file.");
 	args::HelpFlag help(parser, "help", "Display this help menu", { 'h', "help" });
@@ -155,6 +189,11 @@ int main(int argc, const char ** argv) {
 	args::Flag sols(parser, "sols", "Display the \"solutions\" (output boxes) on the standard output.",
 			{ 's', "sols" });
 	args::ValueFlag<double> random_seed(parser, "float", _random_seed.str(), { "random-seed" });
+	args::ValueFlag<string> param_bisection(parser, "string",
+			"Bisection of parameter boxes: all (all dimensions), largest (largest first), smear or rr (round-robin). Default value is all.",
+			{ "param-bisection" }, "all");
+	args::ValueFlag<int> threads(parser, "int",
+			"Number of search threads. Default value is 1. Not compatible with path finding.", { "threads" }, 1);
 	args::Flag quiet(parser, "quiet", "Print no report on the standard output.", { 'q', "quiet" });
 	args::ValueFlag<string> forced_params(parser, "vars",
 			"Force some variables to be parameters in the parametric proofs.", { "forced-params" });
@@ -248,6 +287,15 @@ int main(int argc, const char ** argv) {
 				cout << "  output format:\tTXT" << endl;
 		}
 
+		ParameterBisector::default_policy = ParameterBisector::parse_policy(param_bisection.Get());
+
+		if (threads.Get() < 1) {
+			ibex::ibex_error("the number of threads must be positive");
+		}
+		if (threads.Get() > 1 && start_point && goal_point) {
+			ibex::ibex_error("--threads and path finding cannot be combined");
+		}
+
 		// Build the default solver
 		if (random_seed) {
 			srand(random_seed.Get());
@@ -270,6 +318,9 @@ int main(int argc, const char ** argv) {
 			}
 			buffer = new ibex::CellBufferNeighborhood(start_vector, goal_vector, heuristic);
 			pathFinding = true;
+		} else if (threads.Get() > 1) {
+			buffer = new ibex::CellWorkStealingStack(threads.Get());
+			pathFinding = false;
 		} else {
 			buffer = new ibex::CellStack;
 			pathFinding = false;
@@ -281,42 +332,25 @@ int main(int argc, const char ** argv) {
 		 ibex::CellBufferNeighborhood buffer(start, goal);*/
 		ibex::RoundRobin bisector = ibex::RoundRobin(0);
 
-		GoldsztejnSICBisector* sic_bisector = new GoldsztejnSICBisector(system);
-		CtcFilterSICParameters* sic_filter = new CtcFilterSICParameters(system);
-		GoldsztejnSICBisector* sic_bisector2 = new GoldsztejnSICBisector(system);
-		CtcFilterSICParameters* sic_filter2 = new CtcFilterSICParameters(system);
-		CtcEvaluation* evaluation = new CtcEvaluation(system);
-
-		// FixPoint
-		vector<Ctc*> fixpoint_list;
-		CtcHC4SIP* hc4_2 = new CtcHC4SIP(system, 0.1, true);
-		fixpoint_list.emplace_back(hc4_2);
-
-		/*RelaxationLinearizerSIP* relax = new RelaxationLinearizerSIP(system,
-		 RelaxationLinearizerSIP::CornerPolicy::random, true);
-		 IbexCtcWrapper* ph = new IbexCtcWrapper(*(new ibex::CtcPolytopeHull(*relax, 1000000, 10000)));
-		 fixpoint_list.emplace_back(ph);*/
-		//fixpoint_list.emplace_back(sic_bisector2);
-		//fixpoint_list.emplace_back(sic_filter2);
-		//CtcBlankenship* blankenship = new CtcBlankenship(system, 0.1, 1000);
-		//fixpoint_list.emplace_back(blankenship);
-		CtcCompo* compo = new CtcCompo(fixpoint_list);
-		CtcFixPoint* fixpoint = new CtcFixPoint(*compo, 0.1); // Best: 0.1
-
-		vector<Ctc*> ctc_list;
-		ctc_list.emplace_back(sic_bisector);
-		ctc_list.emplace_back(sic_filter);
-		CtcHC4SIP* hc4 = new CtcHC4SIP(system, 0.01, true);
-		ctc_list.emplace_back(hc4);
-		ctc_list.emplace_back(fixpoint);
-		//ctc_list.emplace_back(evaluation);
-
-		CtcCompo* ctc = new CtcCompo(ctc_list);
+		Ctc* ctc = build_contractor(system);
 
 		ibex::Vector eps_min(system.nb_var, eps_x_min ? eps_x_min.Get() : default_eps_x_min);
 		ibex::Vector eps_max(system.nb_var, eps_x_max ? eps_x_max.Get() : default_eps_x_max);
 		SIPSolver solver(system, *ctc, bisector, *buffer, eps_min, eps_max, pathFinding);
 
+		// ibex Functions are not reentrant: each extra thread works on its own copy of the system
+		vector<SIPSystem*> thread_systems;
+		vector<RoundRobin*> thread_bisectors;
+		for (int t = 1; t < threads.Get(); ++t) {
+			SIPSystem* thread_sys = system.clone();
+			thread_sys->seed((random_seed ? (unsigned long) random_seed.Get() : 0) + t);
+			thread_systems.push_back(thread_sys);
+			thread_bisectors.push_back(new RoundRobin(0));
+			solver.add_worker(*thread_sys, *build_contractor(*thread_sys), *thread_bisectors.back());
+		}
+		if (threads.Get() > 1 && !quiet)
+			cout << "  threads:\t\t" << threads.Get() << endl;
+
 		if (boundary_test_arg) {
 
 			if (boundary_test_arg.Get() == "true")
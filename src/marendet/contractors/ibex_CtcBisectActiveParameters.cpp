@@ -21,7 +21,9 @@ namespace ibex {
 CtcBisectActiveParameters::CtcBisectActiveParameters(const SIPSystem& sys)
 : Ctc(sys.ext_nb_var), sys_(sys),
 linearizer_(sys_, RelaxationLinearizerSIP::CornerPolicy::random, false),
-lp_solver_(sys.ext_nb_var, LPSolver::Mode::NotCertified) {
+lp_solver_(sys.ext_nb_var, LPSolver::Mode::NotCertified),
+row_model_(lp_solver_) {
+    linearizer_.set_row_model(&row_model_);
 
 }
 
@@ -40,7 +42,8 @@ void CtcBisectActiveParameters::contract(IntervalVector& box) {
 
 }
 void CtcBisectActiveParameters::contract(IntervalVector& box, ContractContext& context) {
-    lp_solver_.clear_constraints();
+    // The rows of the ancestors of the node are kept, the solver restarts from its last basis
+    row_model_.begin(box);
 	lp_solver_.set_bounds(box);
 	lp_solver_.set_cost(sys_.ext_nb_var - 1, 1.0);
 	if(linearizer_.linearize(box, lp_solver_, context.prop) < 0) {
@@ -13,6 +13,7 @@
 #define __SIP_IBEX_CTC_BISECT_ACTIVE_PARAMETERS_H_
 
 #include "ibex_Ctc.h"
+#include "ibex_LPRowModel.h"
 #include "ibex_RelaxationLinearizerSIP.h"
 
 namespace ibex {
@@ -23,6 +24,7 @@ private:
     const SIPSystem& sys_;
     RelaxationLinearizerSIP linearizer_;
     LPSolver lp_solver_;
+    LPRowModel row_model_;
 public:
     CtcBisectActiveParameters(const SIPSystem& system);
     virtual ~CtcBisectActiveParameters();
@@ -54,8 +54,9 @@ void CtcEvaluation::contract(IntervalVector& box, ContractContext& context) {
 		//system_.sic_constraints_[i].cache_->update_cache(*system_.sic_constraints_[i].function_, box);
 		cache.update_cache(*system_.sic_constraints_[i].function_, box);
 		//const auto& cacheList = system_.node_data_->sic_constraints_caches[i];
-		for(const auto& mem_box : cache.parameter_caches_) {
-			if(mem_box.evaluation.lb() > 0) {
+		const double* evaluation_lb = cache.parameter_caches_.evaluation_lb();
+		for(int j = 0; j < cache.parameter_caches_.size(); ++j) {
+			if(evaluation_lb[j] > 0) {
 				box.set_empty();
 				return;
 			}
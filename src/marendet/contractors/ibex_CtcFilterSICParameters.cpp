@@ -50,10 +50,14 @@ void CtcFilterSICParameters::contract(IntervalVector& box, ContractContext& cont
 	for (int i = 0; i < system_.sic_constraints_.size(); ++i) {
 		//node_data.sic_constraints_caches[i].update_cache(*system_.sic_constraints_[i].function_, box);
 		//contractOneConstraint(i, node_data, box);
-		simplify_paving(system_.sic_constraints_[i], node_data->sic_constraints_caches[i], box, true);
+		simplify_paving(system_.sic_constraints_[i], node_data->sic_constraints_caches[i], box, true, &stats_);
 	}
 }
 
+const PavingFilterStats& CtcFilterSICParameters::stats() const {
+	return stats_;
+}
+
 /*void CtcFilterSICParameters::contractOneConstraint(size_t i, BxpNodeData& node_data, const IntervalVector& box) {
 	auto& list = node_data.sic_constraints_caches[i].parameter_caches_;
 	auto it = list.begin();
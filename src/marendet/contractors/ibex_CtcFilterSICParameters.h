@@ -12,6 +12,7 @@
 #ifndef __SIP_IBEX_CTCFILTERSICPARAMETERS_H__
 #define __SIP_IBEX_CTCFILTERSICPARAMETERS_H__
 
+#include "ibex_SICPaving.h"
 #include "ibex_SIPSystem.h"
 
 #include "ibex_Ctc.h"
@@ -28,6 +29,7 @@ namespace ibex {
 class CtcFilterSICParameters: public Ctc {
 private:
 	const SIPSystem& system_;
+	PavingFilterStats stats_;
 	//void contractOneConstraint(size_t i, BxpNodeData& node_data, const IntervalVector& box);
 public:
 	CtcFilterSICParameters(const SIPSystem& system_);
@@ -35,6 +37,11 @@ public:
 	void add_property(const IntervalVector& init_box, BoxProperties& map);
     void contract(IntervalVector& box);
     void contract(IntervalVector& box, ContractContext& context);
+
+    /**
+     * \brief Number of parameter boxes removed by each filter since the creation of the contractor.
+     */
+    const PavingFilterStats& stats() const;
 };
 
 } // end namespace ibex
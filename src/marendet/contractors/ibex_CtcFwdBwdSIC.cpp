@@ -13,6 +13,7 @@
 
 #include "ibex_SIConstraint.h"
 #include "ibex_SIConstraintCache.h"
+#include "ibex_ParameterPointPool.h"
 #include "ibex_SIPSystem.h"
 
 
@@ -75,8 +76,9 @@ void CtcFwdBwdSIC::contract(IntervalVector &box, ContractContext& context) {
 	}
 
 	auto& cache = node_data->sic_constraints_caches[sic_index_];
-	for (const auto& parameter_box : cache.parameter_caches_) {
-		full_box.put(nb_var, parameter_box.parameter_box.mid());
+	const ParameterPaving& paving = cache.parameter_caches_;
+	for (int i = 0; i < paving.size(); ++i) {
+		paving.put_parameter_mid(i, full_box, nb_var);
 		if (!constraint_.function_->backward(backward_domain_, full_box)) {
 			fixpoint = false;
 		}
@@ -99,6 +101,19 @@ void CtcFwdBwdSIC::contract(IntervalVector &box, ContractContext& context) {
 		}
 	}
 
+	// Worst-case parameters found in the other nodes
+	if (!full_box.is_empty() && system_.parameter_point_pool != nullptr) {
+		ParameterPointPool& pool = *system_.parameter_point_pool;
+		for (const Vector& point : pool.select(sic_index_, box, pool.nb_seeds)) {
+			full_box.put(nb_var, point);
+			if (!constraint_.function_->backward(backward_domain_, full_box)) {
+				fixpoint = false;
+			}
+			if (full_box.is_empty())
+				break;
+		}
+	}
+
 	box = full_box.subvector(0, nb_var - 1);
 	//if(full_box.is_empty())
 	//	box.set_empty();
@@ -28,8 +28,9 @@ using namespace std;
 
 namespace ibex {
 
-GoldsztejnSICBisector::GoldsztejnSICBisector(const SIPSystem& system, double ratio) :
-		Ctc(system.ext_nb_var), system_(system), ratio_(ratio) {
+GoldsztejnSICBisector::GoldsztejnSICBisector(const SIPSystem& system, double ratio,
+		ParameterBisector::Policy policy) :
+		Ctc(system.ext_nb_var), system_(system), ratio_(ratio), policy_(policy) {
 
 }
 
@@ -39,8 +40,22 @@ GoldsztejnSICBisector::~GoldsztejnSICBisector() {
 
 ParameterEvaluationsCache _createNewCache(const SIConstraint& constraint, const IntervalVector& box,
 		const IntervalVector& parameter_box) {
-	return ParameterEvaluationsCache(parameter_box, constraint.evaluate(box, parameter_box),
-			constraint.gradient(box, parameter_box));
+	IntervalVector full_gradient(constraint.function_->nb_var());
+	const Interval evaluation = constraint.evaluate(box, parameter_box, full_gradient);
+	return ParameterEvaluationsCache(parameter_box, evaluation, full_gradient);
+}
+
+// Bisect the row i of the paving and evaluate the children
+void _bisectCache(ParameterPaving& paving, int i, const ParameterBisector& bisector, const SIConstraint& constraint,
+		const IntervalVector& box) {
+	const int first_new_row = paving.size();
+	if (!bisector.bisect(paving, i)) {
+		return;
+	}
+	paving.set(i, _createNewCache(constraint, box, paving.parameter_box(i)));
+	for (int j = first_new_row; j < paving.size(); ++j) {
+		paving.set(j, _createNewCache(constraint, box, paving.parameter_box(j)));
+	}
 }
 
 void GoldsztejnSICBisector::add_property(const IntervalVector& init_box, BoxProperties& map) {
@@ -67,36 +82,31 @@ void GoldsztejnSICBisector::contract(IntervalVector& box, ContractContext& conte
 		// Retrieve list of box and the associated constraint
 		bool hasBisected = false;
 		auto& cacheList = node_data->sic_constraints_caches[cst_index].parameter_caches_;
-		std::sort(cacheList.begin(), cacheList.end(),
-				[](const ParameterEvaluationsCache& p1, const ParameterEvaluationsCache& p2) {
-					return p1.evaluation.ub() > p2.evaluation.ub();
-				});
+		cacheList.sort_by_evaluation_ub();
 		const SIConstraint& constraint = system_.sic_constraints_[cst_index];
+		const ParameterBisector bisector(constraint.variable_count_, policy_);
 		const int bisection_limit = 50;
 		int bisections = 0;
 
 		int largest_index = -1;
 		double largest_diam = 0;
-		std::vector<IntervalVector> largest_list; 
 		for (int i = 0; i < cacheList.size() /*&& bisections < bisection_limit*/; ++i) {
-			if (!cacheList[i].parameter_box.is_bisectable())
+			if (!cacheList.is_bisectable(i))
 				continue;
-			auto bisectList = bisectAllDim(cacheList[i].parameter_box);
-			if(largest_index < 0 || cacheList[i].parameter_box.max_diam() > largest_diam) {
-				largest_diam = cacheList[i].parameter_box.max_diam();
+			const IntervalVector parameter_box = cacheList.parameter_box(i);
+			auto bisectList = bisector.children(cacheList, i);
+			if(largest_index < 0 || cacheList.max_diam(i) > largest_diam) {
+				largest_diam = cacheList.max_diam(i);
 				largest_index = i;
-				largest_list = bisectList;
 			}
-			Interval z = constraint.evaluate(box, cacheList[i].parameter_box);
+			Interval z = constraint.evaluate(box, parameter_box);
 			if (std::any_of(bisectList.begin(), bisectList.end(), [&](const IntervalVector& iv) {
 				Interval newz = constraint.evaluate(box, iv);
 				return newz.diam()/z.diam() <= ratio_;
 			})) {
 				hasBisected = true;
 				bisections++;
-				cacheList[i] = _createNewCache(constraint, box, bisectList[0]);
-				for (int j = 1; j < bisectList.size(); ++j)
-					cacheList.emplace_back(_createNewCache(constraint, box, bisectList[j]));
+				_bisectCache(cacheList, i, bisector, constraint, box);
 			}
 			/*auto pair = bisector.bisect(cacheList[i].parameter_box);
 			 Interval z1 = constraint.evaluate(box, pair.first);
@@ -122,10 +132,7 @@ void GoldsztejnSICBisector::contract(IntervalVector& box, ContractContext& conte
 		}*/
 
 		if(largest_index >= 0) {
-			cacheList[largest_index] = _createNewCache(constraint, box, largest_list[0]);
-			for (int j = 1; j < largest_list.size(); ++j) {
-				cacheList.emplace_back(_createNewCache(constraint, box, largest_list[j]));
-			}
+			_bisectCache(cacheList, largest_index, bisector, constraint, box);
 		}
 	}
 }
@@ -12,6 +12,7 @@
 #ifndef __SIP_IBEX_GOLDSZTEJNSICBISECTOR_H__
 #define __SIP_IBEX_GOLDSZTEJNSICBISECTOR_H__
 
+#include "ibex_ParameterBisector.h"
 #include "ibex_SIPSystem.h"
 
 #include "ibex_Ctc.h"
@@ -22,13 +23,16 @@ namespace ibex {
  *
  * Bisect parameter boxes if the evaluation of the bisection of a parameter box if the ratio of rel_diam() of the original box
  * over the bisected box is less than a certain value.
+ * Parameter boxes are bisected according to a ParameterBisector policy.
  */
 class GoldsztejnSICBisector : public Ctc {
     const SIPSystem& system_;
     static constexpr double default_ratio = 0.8;
     const double ratio_;
+    const ParameterBisector::Policy policy_;
 public:
-    GoldsztejnSICBisector(const SIPSystem& system, double ratio=default_ratio);
+    GoldsztejnSICBisector(const SIPSystem& system, double ratio=default_ratio,
+    		ParameterBisector::Policy policy=ParameterBisector::default_policy);
     ~GoldsztejnSICBisector();
     void add_property(const IntervalVector& init_box, BoxProperties& map);
     void contract(IntervalVector& box);
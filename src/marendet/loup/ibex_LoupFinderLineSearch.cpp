@@ -21,6 +21,8 @@
 #include "ibex_Vector.h"
 #include "ibex_SICPaving.h"
 
+#include <cmath>
+#include <exception>
 #include <vector>
 
 using namespace std;
@@ -28,20 +30,31 @@ using namespace std;
 namespace ibex {
 
 const double LoupFinderLineSearch::default_sigma = 0.9;
+const double LoupFinderLineSearch::default_target_improvement = 1e-3;
+
+LoupFinderLineSearch::Lane::Lane(const SIPSystem& system, SIPSystem* owned_system) :
+		owned_system(owned_system), system(owned_system != nullptr ? *owned_system : system),
+		dir_solver(system.ext_nb_var, LPSolver::Mode::NotCertified, 1e-9, 10000, 10000),
+		corner_solver(system.nb_var, LPSolver::Mode::Certified, 1e-9, 10000, 10000),
+		corner_linearizer(this->system, RestrictionLinearizerSIP::CornerPolicy::random), node_data(nullptr) {
+}
 
 LoupFinderLineSearch::LoupFinderLineSearch(const SIPSystem& system, const std::set<InnerPointStrategy>& strategies) :
-		LoupFinderSIP(system), strategies_(strategies), linearizer_(system, RelaxationLinearizerSIP::CornerPolicy::random, false), lp_solver_(
-				system.ext_nb_var, LPSolver::Mode::Certified, 1e-9, 10000, 10000), relax_point_(system.ext_nb_var),
-				dir_solver_(system.ext_nb_var, LPSolver::Mode::NotCertified, 1e-9, 10000, 10000),
-				corner_solver_(new LPSolver(system.nb_var, LPSolver::Mode::Certified, 1e-9, 10000, 10000)),
-				corner_linearizer_(new RestrictionLinearizerSIP(system, RestrictionLinearizerSIP::CornerPolicy::random)),
-				sigma_(default_sigma) {
+		LoupFinderSIP(system), concurrent(false), target_improvement(default_target_improvement),
+		strategies_(strategies), linearizer_(system, RelaxationLinearizerSIP::CornerPolicy::random, false), lp_solver_(
+				system.ext_nb_var, LPSolver::Mode::Certified, 1e-9, 10000, 10000), row_model_(lp_solver_),
+				relax_point_(system.ext_nb_var),
+				relax_rows_(1, 1), relax_dual_(1), sigma_(default_sigma), cancelled_(false), target_loup_(NEG_INFINITY) {
+	linearizer_.set_row_model(&row_model_);
+	lanes_.push_back(new Lane(system));
 }
 
 LoupFinderLineSearch::~LoupFinderLineSearch() {
+	lane_pool_.reset();
 	delete initial_node_data_;
-	delete corner_linearizer_;
-	delete corner_solver_;
+	for (Lane* lane : lanes_) {
+		delete lane;
+	}
 }
 
 bool LoupFinderLineSearch::do_strategy(InnerPointStrategy strategy) {
@@ -66,7 +79,8 @@ std::pair<IntervalVector, double> LoupFinderLineSearch::find(const IntervalVecto
 	box_ = box;
 	delete_node_data_ = false;
 	ext_box_ = sip_to_ext_box(box, system_.goal_function_->eval(box));
-	lp_solver_.clear_constraints();
+	// The rows of the ancestors of the node are kept, the solver restarts from its last basis
+	row_model_.begin(ext_box_);
 	lp_solver_.set_bounds(ext_box_);
 	lp_solver_.set_cost(system_.ext_nb_var - 1, 1.0);
 	if(linearizer_.linearize(ext_box_, lp_solver_, prop) < 0) {
@@ -93,49 +107,44 @@ std::pair<IntervalVector, double> LoupFinderLineSearch::find(const IntervalVecto
 	/****************** DIRECTION **********************/
 
 	double g_relax_point = system_.max_constraints(relax_point_, *node_data_);
-	Vector direction(system_.nb_var);
-	double obj = 0;
 	double best_loup = loup;
 	Vector best_loup_point = loup_point.mid();
 	bool loup_found = false;
 
-	if(do_strategy(BLANKENSHIP) && blankenship_direction(direction, obj)) {
-			double tk = -1./sigma_*g_relax_point/obj;
-			Vector end_point = sol_without_goal + tk*direction;
-			bool b = line_search(sol_without_goal, end_point, best_loup_point, best_loup);
-			loup_found = b || loup_found;
-	}
-	if(do_strategy(ACTIVE_RELAXATIONS) && relaxations_direction(direction, obj, true)) {
-			double tk = -1./sigma_*g_relax_point/obj;
-			Vector end_point = sol_without_goal + tk*direction;
-			bool b = line_search(sol_without_goal, end_point, best_loup_point, best_loup);
-			loup_found = b || loup_found;
-	}
-	if(do_strategy(ALL_RELAXATIONS) && relaxations_direction(direction, obj, false)) {
-			double tk = -1./sigma_*g_relax_point/obj;
-			Vector end_point = sol_without_goal + tk*direction;
-			bool b = line_search(sol_without_goal, end_point, best_loup_point, best_loup);
-			loup_found = b || loup_found;
-	}
-	if(do_strategy(STEIN) && stein_direction(direction, obj)) {
-			double tk = -1./sigma_*g_relax_point/obj;
-			Vector end_point = sol_without_goal + tk*direction;
-			bool b = line_search(sol_without_goal, end_point, best_loup_point, best_loup);
-			loup_found = b || loup_found;
+	if (do_strategy(ACTIVE_RELAXATIONS) || do_strategy(ALL_RELAXATIONS)) {
+		// The bound rows, then the rows of this node only: the rows of the ancestors are left out
+		const Matrix rows = lp_solver_.rows();
+		const Vector dual = lp_solver_.not_proved_dual_sol();
+		const int nb_bounds = system_.ext_nb_var;
+		const int first = nb_bounds + row_model_.first_row();
+		Matrix node_rows(nb_bounds + rows.nb_rows() - first, rows.nb_cols());
+		Vector node_dual(node_rows.nb_rows());
+		for (int i = 0; i < node_rows.nb_rows(); ++i) {
+			const int j = i < nb_bounds ? i : first + i - nb_bounds;
+			node_rows[i] = rows[j];
+			node_dual[i] = dual[j];
+		}
+		relax_rows_ = node_rows;
+		relax_dual_ = node_dual;
 	}
-	if(do_strategy(MIDPOINT)) {
-		bool b = line_search(sol_without_goal, box_.mid(), best_loup_point, best_loup);
-		loup_found = b || loup_found;
+	vector<InnerPointStrategy> order;
+	for (InnerPointStrategy strategy : { BLANKENSHIP, ACTIVE_RELAXATIONS, ALL_RELAXATIONS, STEIN, MIDPOINT, CORNER }) {
+		if (do_strategy(strategy)) {
+			order.push_back(strategy);
+		}
 	}
-	if(do_strategy(CORNER)) {
-		Vector corner_loup(system_.nb_var);
-		if(corner_restrictions(corner_loup)) {
-			bool b = line_search(sol_without_goal, corner_loup, best_loup_point, best_loup);
+	if (concurrent && order.size() > 1) {
+		loup_found = run_concurrently(order, sol_without_goal, g_relax_point, best_loup_point, best_loup);
+	} else {
+		Lane& lane = *lanes_[0];
+		lane.node_data = node_data_;
+		for (InnerPointStrategy strategy : order) {
+			bool b = run_strategy(lane, strategy, sol_without_goal, g_relax_point, best_loup_point, best_loup);
 			loup_found = b || loup_found;
 		}
 	}
 	if (loup_found) {
-		/*if(!is_inner_with_paving_simplification(best_loup_point, initial_node_data_, 10)) {
+		/*if(!is_inner_with_paving_simplification(best_loup_point, initial_node_data_)) {
 			ibex_warning("Loup point is not feasible!");
 		}*/
 		return make_pair(best_loup_point, best_loup);
@@ -143,13 +152,130 @@ std::pair<IntervalVector, double> LoupFinderLineSearch::find(const IntervalVecto
 	throw NotFound();
 }
 
-inline
-bool LoupFinderLineSearch::is_inner_with_paving_simplification(const IntervalVector& box, const BxpNodeData* local_node_data, int kmax) {
+bool LoupFinderLineSearch::run_strategy(Lane& lane, InnerPointStrategy strategy, const Vector& start_point,
+		double g_start_point, Vector& loup_point, double& loup) {
+	if (cancelled_) {
+		return false;
+	}
+	Vector direction(lane.system.nb_var);
+	double obj = 0;
+	switch (strategy) {
+	case BLANKENSHIP:
+		if (!blankenship_direction(lane, direction, obj)) {
+			return false;
+		}
+		break;
+	case ACTIVE_RELAXATIONS:
+		if (!relaxations_direction(lane, direction, obj, true)) {
+			return false;
+		}
+		break;
+	case ALL_RELAXATIONS:
+		if (!relaxations_direction(lane, direction, obj, false)) {
+			return false;
+		}
+		break;
+	case STEIN:
+		if (!stein_direction(lane, direction, obj)) {
+			return false;
+		}
+		break;
+	case MIDPOINT:
+		return line_search(lane, start_point, box_.mid(), loup_point, loup);
+	case CORNER: {
+		Vector corner_loup(lane.system.nb_var);
+		return corner_restrictions(lane, corner_loup) && line_search(lane, start_point, corner_loup, loup_point, loup);
+	}
+	}
+	double tk = -1./sigma_*g_start_point/obj;
+	Vector end_point = start_point + tk*direction;
+	return line_search(lane, start_point, end_point, loup_point, loup);
+}
+
+bool LoupFinderLineSearch::run_concurrently(const vector<InnerPointStrategy>& order, const Vector& start_point,
+		double g_start_point, Vector& loup_point, double& loup) {
+	const int n = order.size();
+	// ibex Functions are not reentrant: the other lanes work on copies of the system
+	// Each copy draws its own random corners, seeded from the engine of the system
+	while ((int) lanes_.size() < n) {
+		SIPSystem* lane_system = system_.clone();
+		lane_system->seed(system_.random_engine()() + lanes_.size());
+		lanes_.push_back(new Lane(system_, lane_system));
+	}
+	// Persistent workers: find() is called twice per node
+	if (lane_pool_ == nullptr || lane_pool_->nb_threads() < n) {
+		lane_pool_.reset(new PavingThreadPool(n));
+		lane_pool_->threshold = 1;
+	}
+	// The node data is written by the Blankenship strategies
+	vector<std::unique_ptr<BxpNodeData>> node_datas;
+	for (int k = 0; k < n; ++k) {
+		node_datas.emplace_back(new BxpNodeData(*node_data_));
+		lanes_[k]->node_data = node_datas.back().get();
+	}
+	vector<Vector> loup_points(n, loup_point);
+	vector<double> loups(n, loup);
+	vector<char> found(n, false);
+	vector<std::exception_ptr> errors(n);
+	cancelled_ = false;
+	target_loup_ = loup < POS_INFINITY ? loup - target_improvement * std::fabs(loup) : POS_INFINITY;
+	auto run = [&](int k) {
+		try {
+			found[k] = run_strategy(*lanes_[k], order[k], start_point, g_start_point, loup_points[k], loups[k]);
+			if (found[k] && loups[k] < target_loup_) {
+				cancelled_ = true;
+			}
+		} catch (...) {
+			errors[k] = std::current_exception();
+			cancelled_ = true;
+		}
+	};
+	// One lane per slot, the first one on the calling thread
+	lane_pool_->parallel_for(n, [&](int begin, int end, int slot) {
+		for (int k = begin; k < end; ++k) {
+			run(k);
+		}
+	});
+	cancelled_ = false;
+	for (int k = 0; k < n; ++k) {
+		if (errors[k]) {
+			std::rethrow_exception(errors[k]);
+		}
+	}
+	// The Blankenship points are kept in the node for the next calls,
+	// as in a sequential run (the last strategy computing them wins)
+	for (int k = 0; k < n; ++k) {
+		if (order[k] == BLANKENSHIP || order[k] == STEIN) {
+			for (int i = 0; i < (int) system_.sic_constraints_.size(); ++i) {
+				node_data_->sic_constraints_caches[i].best_blankenship_points_ =
+						node_datas[k]->sic_constraints_caches[i].best_blankenship_points_;
+			}
+		}
+	}
+	// Best loup, the first strategy in case of ties
+	bool loup_found = false;
+	for (int k = 0; k < n; ++k) {
+		if (found[k] && loups[k] < loup) {
+			loup = loups[k];
+			loup_point = loup_points[k];
+			loup_found = true;
+		}
+	}
+	return loup_found;
+}
+
+bool LoupFinderLineSearch::is_inner_with_paving_simplification(const IntervalVector& box,
+		const BxpNodeData* local_node_data, int kmax) {
+	return is_inner_with_paving_simplification(*lanes_[0], box, local_node_data, kmax);
+}
+
+bool LoupFinderLineSearch::is_inner_with_paving_simplification(Lane& lane, const IntervalVector& box,
+		const BxpNodeData* local_node_data, int kmax) {
 	if(!local_node_data->init_box.is_superset(box)) {
 		return false;
 	}
-	for(int i = 0; i < system_.normal_constraints_.size()-1; ++i) {
-		if(!system_.normal_constraints_[i].isSatisfied(box)) {
+	for(int i = 0; i < lane.system.normal_constraints_.size()-1; ++i) {
+		if(!lane.system.normal_constraints_[i].isSatisfied(box)) {
 			return false;
 		}
 	}
@@ -157,22 +283,26 @@ bool LoupFinderLineSearch::is_inner_with_paving_simplification(const IntervalVec
 	//BxpNodeData node_data_copy = BxpNodeData(*system_.node_data_);
 	BxpNodeData node_data_copy = BxpNodeData(*local_node_data);
 
-	for(int cst_index = 0; cst_index < system_.sic_constraints_.size(); ++cst_index) {
-		const auto& sic = system_.sic_constraints_[cst_index];
+	for(int cst_index = 0; cst_index < lane.system.sic_constraints_.size(); ++cst_index) {
+		const auto& sic = lane.system.sic_constraints_[cst_index];
 		auto& cache = node_data_copy.sic_constraints_caches[cst_index];
 		simplify_paving(sic, cache, box, true);
 	}
 	for(int i = 0; i < kmax; ++i) {
-		for(int cst_index = 0; cst_index < system_.sic_constraints_.size(); ++cst_index) {
-			const auto& sic = system_.sic_constraints_[cst_index];
+		if (cancelled_) {
+			// Not proved inner
+			return false;
+		}
+		for(int cst_index = 0; cst_index < lane.system.sic_constraints_.size(); ++cst_index) {
+			const auto& sic = lane.system.sic_constraints_[cst_index];
 			auto& cache = node_data_copy.sic_constraints_caches[cst_index];
-			bisect_paving(cache);
+			bisect_paving(cache, ParameterBisector(sic.variable_count_));
 			simplify_paving(sic, cache, box, true);
 		}
 	}
 
-	for(int cst_index = 0; cst_index < system_.sic_constraints_.size(); ++cst_index) {
-		const auto& sic = system_.sic_constraints_[cst_index];
+	for(int cst_index = 0; cst_index < lane.system.sic_constraints_.size(); ++cst_index) {
+		const auto& sic = lane.system.sic_constraints_[cst_index];
 		auto& cache = node_data_copy.sic_constraints_caches[cst_index];
 		if(!is_feasible_with_paving(sic, cache, box)) {
 			return false;
@@ -181,31 +311,30 @@ bool LoupFinderLineSearch::is_inner_with_paving_simplification(const IntervalVec
 	return true;
 }
 
-bool LoupFinderLineSearch::relaxations_direction(Vector& direction, double& obj, bool actives_only, bool with_sides) {
-	Matrix A = lp_solver_.rows();
-	Vector dual = lp_solver_.not_proved_dual_sol();
-	IntervalVector rhs = lp_solver_.lhs_rhs();
+bool LoupFinderLineSearch::relaxations_direction(Lane& lane, Vector& direction, double& obj, bool actives_only, bool with_sides) {
+	const Matrix& A = relax_rows_;
+	const Vector& dual = relax_dual_;
 	vector<Vector> active_constraints;
 
-	for (int i = system_.ext_nb_var + 1; i < A.nb_rows(); ++i) {
+	for (int i = lane.system.ext_nb_var + 1; i < A.nb_rows(); ++i) {
 		if (!actives_only || !Interval(dual[i]).inflate(1e-10).contains(0)) {
-			active_constraints.emplace_back(A.row(i).subvector(0, system_.nb_var-1));
+			active_constraints.emplace_back(A.row(i).subvector(0, lane.system.nb_var-1));
 		}
 		/*Interval cst_eval = A.row(i) * sol - rhs[i].ub();
 		if (cst_eval.inflate(1e-10).contains(0)) {
-			active_constraints.emplace_back(A.row(i).subvector(0, system_.nb_var-1));
+			active_constraints.emplace_back(A.row(i).subvector(0, lane.system.nb_var-1));
 		}*/
 	}
 
 	if(with_sides) {
-		for (int i = 0; i < system_.nb_var; ++i) {
-			if (Interval(node_data_->init_box[i].lb()).inflate(1e-10).contains(relax_point_[i])) {
-				Vector cst(system_.nb_var, 0.0);
+		for (int i = 0; i < lane.system.nb_var; ++i) {
+			if (Interval(lane.node_data->init_box[i].lb()).inflate(1e-10).contains(relax_point_[i])) {
+				Vector cst(lane.system.nb_var, 0.0);
 				cst[box_.size()] = -1;
 				cst[i] = 1;
 				active_constraints.emplace_back(cst);
-			} else if (Interval(node_data_->init_box[i].ub()).inflate(1e-10).contains(relax_point_[i])) {
-				Vector cst(system_.nb_var, 0.0);
+			} else if (Interval(lane.node_data->init_box[i].ub()).inflate(1e-10).contains(relax_point_[i])) {
+				Vector cst(lane.system.nb_var, 0.0);
 				cst[box_.size()] = -1;
 				cst[i] = -1;
 				active_constraints.emplace_back(cst);
@@ -216,99 +345,99 @@ bool LoupFinderLineSearch::relaxations_direction(Vector& direction, double& obj,
 		// That happens when the linear solver does not return a point in a corner of the relaxation
 		return false;
 	}
-	dir_solver_.clear_constraints();
+	lane.dir_solver.clear_constraints();
 	for(int i = 0; i < active_constraints.size(); ++i) {
-    	Vector row(system_.nb_var + 1);
+    	Vector row(lane.system.nb_var + 1);
         row.put(0, active_constraints[i]);
-        row[system_.nb_var] = -1;
-        dir_solver_.add_constraint(row, CmpOp::LEQ, 0);
+        row[lane.system.nb_var] = -1;
+        lane.dir_solver.add_constraint(row, CmpOp::LEQ, 0);
     }
 
-	IntervalVector bounds(system_.nb_var + 1, Interval(-1, 1));
-	bounds[system_.nb_var] = Interval::all_reals();
-	dir_solver_.set_bounds(bounds);
+	IntervalVector bounds(lane.system.nb_var + 1, Interval(-1, 1));
+	bounds[lane.system.nb_var] = Interval::all_reals();
+	lane.dir_solver.set_bounds(bounds);
 
-	dir_solver_.set_cost(system_.nb_var, 1);
+	lane.dir_solver.set_cost(lane.system.nb_var, 1);
 	//std::cout << dir_solver.get_rows() << std::endl;
-	LPSolver::Status dir_solver_status = dir_solver_.minimize();
+	LPSolver::Status dir_solver_status = lane.dir_solver.minimize();
 	if (dir_solver_status != LPSolver::Status::Optimal) {
 		return false;
 	}
-	direction = dir_solver_.not_proved_primal_sol().subvector(0, system_.nb_var-1);
-	obj = dir_solver_.minimum().mid();
+	direction = lane.dir_solver.not_proved_primal_sol().subvector(0, lane.system.nb_var-1);
+	obj = lane.dir_solver.minimum().mid();
 	return true;
 }
 
-bool LoupFinderLineSearch::blankenship_direction(Vector& direction, double& obj) {
-	dir_solver_.clear_constraints();
-	blankenship(relax_point_, system_, node_data_);
-	for(int i = 0; i < system_.sic_constraints_.size(); ++i) {
-        const auto& sic = system_.sic_constraints_[i];
-        const auto& param_boxes = node_data_->sic_constraints_caches[i].parameter_caches_;
-		for(const  Vector& bs_point : node_data_->sic_constraints_caches[i].best_blankenship_points_) {
+bool LoupFinderLineSearch::blankenship_direction(Lane& lane, Vector& direction, double& obj) {
+	lane.dir_solver.clear_constraints();
+	blankenship(relax_point_, lane.system, lane.node_data);
+	for(int i = 0; i < lane.system.sic_constraints_.size(); ++i) {
+        const auto& sic = lane.system.sic_constraints_[i];
+        const auto& param_boxes = lane.node_data->sic_constraints_caches[i].parameter_caches_;
+		for(const  Vector& bs_point : lane.node_data->sic_constraints_caches[i].best_blankenship_points_) {
 			Vector full_grad = (sic.gradient(relax_point_, bs_point)).mid();
-			Vector grad_x = full_grad.subvector(0, system_.ext_nb_var-1);
-			grad_x[system_.ext_nb_var-1] = -1;
+			Vector grad_x = full_grad.subvector(0, lane.system.ext_nb_var-1);
+			grad_x[lane.system.ext_nb_var-1] = -1;
 			//std::cout << print_mma(grad_x) << "," <<  std::endl;
-			dir_solver_.add_constraint(grad_x, CmpOp::LEQ, 0);
+			lane.dir_solver.add_constraint(grad_x, CmpOp::LEQ, 0);
         }
     }
-    for(int i = 0; i < system_.normal_constraints_.size()-1; ++i) {
-        IntervalVector grad = system_.normal_constraints_[i].gradient(relax_point_);
-        Vector grad_x = Vector(system_.ext_nb_var, 0.0);
+    for(int i = 0; i < lane.system.normal_constraints_.size()-1; ++i) {
+        IntervalVector grad = lane.system.normal_constraints_[i].gradient(relax_point_);
+        Vector grad_x = Vector(lane.system.ext_nb_var, 0.0);
         grad_x.put(0, grad.mid());
-        grad_x[system_.ext_nb_var-1] = -1;
-        dir_solver_.add_constraint(grad_x, CmpOp::LEQ, 0);
+        grad_x[lane.system.ext_nb_var-1] = -1;
+        lane.dir_solver.add_constraint(grad_x, CmpOp::LEQ, 0);
     }
 
-	IntervalVector bounds(system_.nb_var + 1, Interval(-1, 1));
-	bounds[system_.nb_var] = Interval::all_reals();
-	dir_solver_.set_bounds(bounds);
+	IntervalVector bounds(lane.system.nb_var + 1, Interval(-1, 1));
+	bounds[lane.system.nb_var] = Interval::all_reals();
+	lane.dir_solver.set_bounds(bounds);
 
-	dir_solver_.set_cost(system_.nb_var, 1);
+	lane.dir_solver.set_cost(lane.system.nb_var, 1);
 	//std::cout << dir_solver.get_rows() << std::endl;
-	LPSolver::Status dir_solver_status = dir_solver_.minimize();
+	LPSolver::Status dir_solver_status = lane.dir_solver.minimize();
 	if (dir_solver_status != LPSolver::Status::Optimal) {
 		return false;
 	}
-	direction = dir_solver_.not_proved_primal_sol().subvector(0, system_.nb_var-1);
-	obj = dir_solver_.minimum().mid();
+	direction = lane.dir_solver.not_proved_primal_sol().subvector(0, lane.system.nb_var-1);
+	obj = lane.dir_solver.minimum().mid();
 	return true;
 }
 
-bool LoupFinderLineSearch::stein_direction(Vector& direction, double& obj) {
-	dir_solver_.clear_constraints();
-	blankenship(relax_point_, system_, node_data_);
-	for(int i = 0; i < system_.sic_constraints_.size(); ++i) {
-        const auto& sic = system_.sic_constraints_[i];
-        const auto& param_boxes = node_data_->sic_constraints_caches[i].parameter_caches_;
+bool LoupFinderLineSearch::stein_direction(Lane& lane, Vector& direction, double& obj) {
+	lane.dir_solver.clear_constraints();
+	blankenship(relax_point_, lane.system, lane.node_data);
+	for(int i = 0; i < lane.system.sic_constraints_.size(); ++i) {
+        const auto& sic = lane.system.sic_constraints_[i];
+        const auto& param_boxes = lane.node_data->sic_constraints_caches[i].parameter_caches_;
         for(int j = 0; j < param_boxes.size(); ++j) {
-            Vector full_grad = sic.gradient(ext_box_.mid(), param_boxes[j].parameter_box.mid()).mid();
-			Vector grad_x = full_grad.subvector(0, system_.ext_nb_var-1);
-			grad_x[system_.ext_nb_var-1] = -1;
-			dir_solver_.add_constraint(grad_x, CmpOp::LEQ, 0);
+            Vector full_grad = sic.gradient(ext_box_.mid(), param_boxes.parameter_mid(j)).mid();
+			Vector grad_x = full_grad.subvector(0, lane.system.ext_nb_var-1);
+			grad_x[lane.system.ext_nb_var-1] = -1;
+			lane.dir_solver.add_constraint(grad_x, CmpOp::LEQ, 0);
         }
     }
-    for(int i = 0; i < system_.normal_constraints_.size()-1; ++i) {
-        IntervalVector grad = system_.normal_constraints_[i].gradient(ext_box_);
-        Vector grad_x = Vector(system_.ext_nb_var, 0.0);
+    for(int i = 0; i < lane.system.normal_constraints_.size()-1; ++i) {
+        IntervalVector grad = lane.system.normal_constraints_[i].gradient(ext_box_);
+        Vector grad_x = Vector(lane.system.ext_nb_var, 0.0);
         grad_x.put(0, grad.mid());
-        grad_x[system_.ext_nb_var-1] = -1;
-        dir_solver_.add_constraint(grad_x, CmpOp::LEQ, 0);
+        grad_x[lane.system.ext_nb_var-1] = -1;
+        lane.dir_solver.add_constraint(grad_x, CmpOp::LEQ, 0);
     }
 
-	IntervalVector bounds(system_.nb_var + 1, Interval(-1, 1));
-	bounds[system_.nb_var] = Interval::all_reals();
-	dir_solver_.set_bounds(bounds);
+	IntervalVector bounds(lane.system.nb_var + 1, Interval(-1, 1));
+	bounds[lane.system.nb_var] = Interval::all_reals();
+	lane.dir_solver.set_bounds(bounds);
 
-	dir_solver_.set_cost(system_.nb_var, 1);
+	lane.dir_solver.set_cost(lane.system.nb_var, 1);
 	//std::cout << dir_solver.get_rows() << std::endl;
-	LPSolver::Status dir_solver_status = dir_solver_.minimize();
+	LPSolver::Status dir_solver_status = lane.dir_solver.minimize();
 	if (dir_solver_status != LPSolver::Status::Optimal) {
 		return false;
 	}
-	direction = dir_solver_.not_proved_primal_sol().subvector(0, system_.nb_var-1);
-	obj = dir_solver_.minimum().mid();
+	direction = lane.dir_solver.not_proved_primal_sol().subvector(0, lane.system.nb_var-1);
+	obj = lane.dir_solver.minimum().mid();
 	return true;
 }
 
@@ -321,9 +450,10 @@ Interval LoupFinderLineSearch::t_value(const Vector& direction) {
 		const auto& constraint = system_.sic_constraints_[sic_index];
 		//const auto& cache = constraint.cache_->parameter_caches_;
 		const auto& cache = node_data_->sic_constraints_caches[sic_index].parameter_caches_;
-		for (const auto& mem_box : cache) {
-			Interval eval = constraint.evaluate(relax_point_, mem_box.parameter_box);
-			IntervalVector gradient_x = constraint.gradient(ext_box_, mem_box.parameter_box).subvector(0,
+		for (int j = 0; j < cache.size(); ++j) {
+			const IntervalVector parameter_box = cache.parameter_box(j);
+			Interval eval = constraint.evaluate(relax_point_, parameter_box);
+			IntervalVector gradient_x = constraint.gradient(ext_box_, parameter_box).subvector(0,
 					system_.nb_var - 1);
 			//IntervalVector gradient_x = mem_box.full_gradient.subvector(0, system_.nb_var-1);
 			t &= (Interval::neg_reals() - eval.ub()) / (gradient_x * direction).ub();
@@ -340,29 +470,32 @@ Interval LoupFinderLineSearch::t_value(const Vector& direction) {
 	return t;
 }
 
-bool LoupFinderLineSearch::line_search(const Vector& start_point, const Vector& inner_point, Vector& loup_point, double& loup) {
-	const BxpNodeData* local_node_data = node_data_;
+bool LoupFinderLineSearch::line_search(Lane& lane, const Vector& start_point, const Vector& inner_point, Vector& loup_point, double& loup) {
+	const BxpNodeData* local_node_data = lane.node_data;
 	bool loup_found = false;
 	bool is_right_inner = false;
 	Vector point = inner_point;
 
-	Vector ext_point = sip_to_ext_box(point, system_.goal_ub(point));
-	if (!ext_box_.subvector(0, system_.nb_var-1).contains(point)) {
+	Vector ext_point = sip_to_ext_box(point, lane.system.goal_ub(point));
+	if (!ext_box_.subvector(0, lane.system.nb_var-1).contains(point)) {
 		local_node_data = initial_node_data_;
 	}
-	if(is_inner_with_paving_simplification(ext_point, local_node_data)) {
+	if(is_inner_with_paving_simplification(lane, ext_point, local_node_data)) {
 		is_right_inner = true;
 	}
-	/*if (check(system_, point, loup, true, *prop_)) {
+	/*if (check(lane.system, point, loup, true, *prop_)) {
 		loup_point = ext_point;
 		loup_found = true;
 	}*/
 	Vector left = start_point;
 	Vector right = point;
 	for(int i = 0; i < 10; ++i) {
+		if (cancelled_) {
+			return false;
+		}
 		Vector middle = 0.5*(left + right);
-		IntervalVector ext_middle = sip_to_ext_box(middle, system_.goal_ub(middle));
-		if(is_inner_with_paving_simplification(ext_middle, local_node_data)) {
+		IntervalVector ext_middle = sip_to_ext_box(middle, lane.system.goal_ub(middle));
+		if(is_inner_with_paving_simplification(lane, ext_middle, local_node_data)) {
 			right = middle;
 			is_right_inner = true;
 		} else if(!is_right_inner) {
@@ -372,41 +505,41 @@ bool LoupFinderLineSearch::line_search(const Vector& start_point, const Vector&
 		}
 	}
 	point = right;
-	ext_point = sip_to_ext_box(point, system_.goal_ub(point));
+	ext_point = sip_to_ext_box(point, lane.system.goal_ub(point));
 	if(!is_right_inner) {
 		return false;
 	}
-	if (check(system_, point, loup, true, *prop_)) {
+	if (check(lane.system, point, loup, true, *prop_)) {
 		loup_point = ext_point;
 		loup_found = true;
 	}
 	return loup_found;
 }
 
-bool LoupFinderLineSearch::corner_restrictions(Vector& loup_point) {
+bool LoupFinderLineSearch::corner_restrictions(Lane& lane, Vector& loup_point) {
 
 	if (box_.is_unbounded())
 		return false;
 
-	corner_solver_->clear_constraints();
-	corner_solver_->set_bounds(box_);
-	IntervalVector ig = system_.goal_function_->gradient(box_.mid());
+	lane.corner_solver.clear_constraints();
+	lane.corner_solver.set_bounds(box_);
+	IntervalVector ig = lane.system.goal_function_->gradient(box_.mid());
 	if(ig.is_empty()) {
 		return false;
 	}
 	Vector g = ig.mid();
-	corner_solver_->set_cost(g);
-	int count = corner_linearizer_->linearize(ext_box_, *corner_solver_, *prop_);
+	lane.corner_solver.set_cost(g);
+	int count = lane.corner_linearizer.linearize(ext_box_, lane.corner_solver, *lane.node_data);
 	if(count < 0) {
 		return false;
 	}
 	//lp_solver_->write_file();
 	//cout << "beforesolve" << endl;
-	LPSolver::Status stat = corner_solver_->minimize();
+	LPSolver::Status stat = lane.corner_solver.minimize();
 	//cout << "aftersolve" << endl;
 	if(stat == LPSolver::Status::OptimalProved) {
 		//Vector loup_point(box_without_goal.size());
-		loup_point = corner_solver_->not_proved_primal_sol();
+		loup_point = lane.corner_solver.not_proved_primal_sol();
 		if(!box_.contains(loup_point)) {
 			return false;
 		}
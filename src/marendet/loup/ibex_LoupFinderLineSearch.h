@@ -12,6 +12,8 @@
 #ifndef __SIP_IBEX_LOUPFINDERLINESEARCH_H__
 #define __SIP_IBEX_LOUPFINDERLINESEARCH_H__
 
+#include "ibex_LPRowModel.h"
+#include "ibex_PavingThreadPool.h"
 #include "ibex_RelaxationLinearizerSIP.h"
 #include "ibex_RestrictionLinearizerSIP.h"
 #include "ibex_SIPSystem.h"
@@ -20,15 +22,35 @@
 #include "ibex_IntervalVector.h"
 #include "ibex_LPSolver.h"
 #include "ibex_LoupFinderSIP.h"
+#include "ibex_Matrix.h"
 
+#include <atomic>
+#include <memory>
 #include <utility>
 #include <set>
+#include <vector>
 
 namespace ibex {
+/**
+ * \brief Upper bounding by line searches from the solution of a linear relaxation.
+ *
+ * Each inner point strategy gives a direction (or a point) for a line search
+ * towards the inside of the feasible region. The strategies are run one after
+ * the other, or concurrently if \a concurrent is true: each strategy then runs
+ * on a worker of a pool owned by the loup finder, with a private copy of the
+ * system, of the LP solvers and of the node data. The best loup found is kept, and the strategies still
+ * running are cancelled as soon as a loup below the target is found.
+ */
 class LoupFinderLineSearch: public LoupFinderSIP {
 public:
 
 	static const double default_sigma;
+
+	/**
+	 * \brief Default relative improvement of the loup that cancels the other strategies: 1e-3.
+	 */
+	static const double default_target_improvement;
+
 	enum InnerPointStrategy {
 		STEIN, ACTIVE_RELAXATIONS, ALL_RELAXATIONS, BLANKENSHIP, MIDPOINT, CORNER
 	};
@@ -40,14 +62,46 @@ public:
 	std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup);
 	std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop);
 	bool is_inner_with_paving_simplification(const IntervalVector& box, const BxpNodeData* local_node_data, int kmax=4);
+
+	/**
+	 * \brief Run the strategies concurrently. Default value is false.
+	 */
+	bool concurrent;
+
+	/**
+	 * \brief In concurrent mode, a loup smaller than loup-target_improvement*|loup|
+	 * cancels the strategies still running (any loup if there was none).
+	 */
+	double target_improvement;
+
 private:
+	/*
+	 * What a strategy writes. The first lane uses the system of the loup
+	 * finder, the other ones (concurrent mode) a clone of it.
+	 */
+	struct Lane {
+		Lane(const SIPSystem& system, SIPSystem* owned_system = nullptr);
+
+		std::unique_ptr<SIPSystem> owned_system;
+		const SIPSystem& system;
+		LPSolver dir_solver;
+		LPSolver corner_solver;
+		RestrictionLinearizerSIP corner_linearizer;
+		BxpNodeData* node_data;
+	};
+
 	std::set<InnerPointStrategy> strategies_;
 	RelaxationLinearizerSIP linearizer_;
 	LPSolver lp_solver_;
+	// Rows of lp_solver_, kept along a lineage of nodes
+	LPRowModel row_model_;
 	Vector relax_point_;
-	LPSolver dir_solver_;
-	LPSolver* corner_solver_;
-	RestrictionLinearizerSIP* corner_linearizer_;
+	// Rows and dual solution of lp_solver_, read by the relaxation strategies
+	Matrix relax_rows_;
+	Vector relax_dual_;
+	std::vector<Lane*> lanes_;
+	// Workers of the lanes in concurrent mode, created with the lanes
+	std::unique_ptr<PavingThreadPool> lane_pool_;
 	double sigma_;
 	IntervalVector box_;
 	IntervalVector ext_box_;
@@ -55,15 +109,28 @@ private:
 	BoxProperties* prop_ = nullptr;
 	const BxpNodeData* initial_node_data_ = nullptr;
 	bool delete_node_data_ = false;
+	std::atomic<bool> cancelled_;
+	double target_loup_;
 
-	bool relaxations_direction(Vector& direction, double& obj, bool actives_only, bool with_sides=false);
-	bool blankenship_direction(Vector& direction, double& obj);
-	bool stein_direction(Vector&, double& obj);
+	bool relaxations_direction(Lane& lane, Vector& direction, double& obj, bool actives_only, bool with_sides=false);
+	bool blankenship_direction(Lane& lane, Vector& direction, double& obj);
+	bool stein_direction(Lane& lane, Vector&, double& obj);
 	Interval t_value(const Vector& direction);
-	bool line_search(const Vector& start_point, const Vector& end_point, Vector& loup_point, double& loup);
+	bool line_search(Lane& lane, const Vector& start_point, const Vector& end_point, Vector& loup_point, double& loup);
+	bool is_inner_with_paving_simplification(Lane& lane, const IntervalVector& box, const BxpNodeData* local_node_data,
+			int kmax=4);
 
 	bool do_strategy(InnerPointStrategy strategy);
-	bool corner_restrictions(Vector& loup_point);
+	bool corner_restrictions(Lane& lane, Vector& loup_point);
+
+	/*
+	 * Direction (or point) of the strategy and line search from start_point.
+	 * Update loup_point and loup and return true if the loup is improved.
+	 */
+	bool run_strategy(Lane& lane, InnerPointStrategy strategy, const Vector& start_point, double g_start_point,
+			Vector& loup_point, double& loup);
+	bool run_concurrently(const std::vector<InnerPointStrategy>& order, const Vector& start_point,
+			double g_start_point, Vector& loup_point, double& loup);
 
 };
 
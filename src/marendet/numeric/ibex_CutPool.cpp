@@ -0,0 +1,152 @@
+/* ============================================================================
+ * I B E X - ibex_CutPool.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_CutPool.h"
+
+#include "ibex_Interval.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+const int CutPool::default_max_size = 20000;
+const int CutPool::default_max_age = 10;
+const int CutPool::default_max_selected = 500;
+const double CutPool::default_reuse_ratio = 0.5;
+
+CutPool::CutPool(int max_size, int max_age) :
+		max_size(max_size), max_age(max_age), max_selected(default_max_selected),
+		reuse_ratio(default_reuse_ratio), nb_added_(0), nb_selected_(0) {
+}
+
+string CutPool::source(int constraint) {
+	return string(reinterpret_cast<const char*>(&constraint), sizeof(constraint));
+}
+
+string CutPool::source(int constraint, const Vector& parameter) {
+	string key = source(constraint);
+	for (int i = 0; i < parameter.size(); ++i) {
+		const double value = parameter[i];
+		key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+	return key;
+}
+
+void CutPool::add(const Vector& lhs, double rhs, const IntervalVector& validity, const string& source) {
+	double norm = 0;
+	for (int j = 0; j < lhs.size(); ++j) {
+		norm += lhs[j] * lhs[j];
+	}
+	norm = std::sqrt(norm);
+	if (norm == 0) {
+		return;
+	}
+	std::lock_guard<std::mutex> lock(mutex_);
+	cuts_.push_back(Cut { lhs, rhs, norm, validity, source, 0, 0 });
+	++nb_added_;
+	if ((int) cuts_.size() > max_size) {
+		purge();
+	}
+}
+
+double CutPool::efficacy(const Cut& cut, const IntervalVector& box) {
+	// Largest value of lhs*x on the box
+	Interval max_lhs(0);
+	for (int j = 0; j < box.size(); ++j) {
+		max_lhs += cut.lhs[j] * box[j];
+	}
+	return (max_lhs.ub() - cut.rhs) / cut.lhs_norm;
+}
+
+bool CutPool::reusable(const Cut& cut, const IntervalVector& box) const {
+	for (int j = 0; j < box.size(); ++j) {
+		if (box[j].diam() < reuse_ratio * cut.validity[j].diam()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+int CutPool::select(const IntervalVector& box, vector<Vector>& lhs, vector<double>& rhs,
+		unordered_set<string>& reused) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	vector<int> candidates;
+	for (int c = 0; c < (int) cuts_.size(); ++c) {
+		Cut& cut = cuts_[c];
+		if (!box.is_subset(cut.validity)) {
+			continue;
+		}
+		cut.efficacy = efficacy(cut, box);
+		if (cut.efficacy > 0) {
+			cut.age = 0;
+			candidates.push_back(c);
+		} else {
+			++cut.age;
+		}
+	}
+	const int count = std::min((int) candidates.size(), max_selected);
+	partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(), [this](int c1, int c2) {
+		return cuts_[c1].efficacy > cuts_[c2].efficacy;
+	});
+	for (int i = 0; i < count; ++i) {
+		const Cut& cut = cuts_[candidates[i]];
+		lhs.push_back(cut.lhs);
+		rhs.push_back(cut.rhs);
+		if (reusable(cut, box)) {
+			reused.insert(cut.source);
+		}
+	}
+	nb_selected_ += count;
+	// The old cuts are removed here, so that the indices of the candidates stay valid above
+	cuts_.erase(remove_if(cuts_.begin(), cuts_.end(), [this](const Cut& cut) {
+		return cut.age > max_age;
+	}), cuts_.end());
+	return count;
+}
+
+void CutPool::purge() {
+	cuts_.erase(remove_if(cuts_.begin(), cuts_.end(), [this](const Cut& cut) {
+		return cut.age > max_age;
+	}), cuts_.end());
+	if ((int) cuts_.size() <= max_size) {
+		return;
+	}
+	// Keep the youngest and most efficient cuts, with some room for new ones
+	const int kept = max_size - max_size / 10;
+	nth_element(cuts_.begin(), cuts_.begin() + kept, cuts_.end(), [](const Cut& c1, const Cut& c2) {
+		return c1.efficacy / (1 + c1.age) > c2.efficacy / (1 + c2.age);
+	});
+	cuts_.erase(cuts_.begin() + kept, cuts_.end());
+}
+
+int CutPool::size() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return cuts_.size();
+}
+
+void CutPool::clear() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	cuts_.clear();
+}
+
+long CutPool::nb_added() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return nb_added_;
+}
+
+long CutPool::nb_selected() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return nb_selected_;
+}
+
+} // end namespace ibex
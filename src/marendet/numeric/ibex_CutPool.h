@@ -0,0 +1,129 @@
+/* ============================================================================
+ * I B E X - ibex_CutPool.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_CUTPOOL_H__
+#define __SIP_IBEX_CUTPOOL_H__
+
+#include "ibex_IntervalVector.h"
+#include "ibex_Vector.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \brief Pool of the outer-approximation cuts of RelaxationLinearizerSIP.
+ *
+ * A cut lhs*x <= rhs linearizes a constraint (at a parameter point, for a
+ * semi-infinite constraint) on a box. It is valid on every sub-box of this
+ * box, its validity box: a cut generated at the root is valid on the whole
+ * domain. The pool keeps the cuts generated at all the nodes and gives back
+ * the ones valid on a new box, the strongest first.
+ *
+ * The efficacy of a cut on a box is the distance, relative to the norm of lhs,
+ * from the cut to the farthest corner of the box it removes. A cut with no
+ * efficacy removes no point of the box. The age of a cut is the number of
+ * consecutive selections in which it was valid without being efficient. Cuts
+ * older than max_age are removed, and the least efficient ones when the pool
+ * is full.
+ *
+ * The pool is protected by a mutex, but the search threads of ibexopt-sip
+ * have a pool each: the selections update the ages and remove cuts, so a
+ * shared pool would make a deterministic search depend on the timing of the
+ * threads, and every linearization would wait for the scan of the others.
+ */
+class CutPool {
+public:
+	/** \brief Default maximal number of cuts: 20000. */
+	static const int default_max_size;
+
+	/** \brief Default maximal age of a cut: 10. */
+	static const int default_max_age;
+
+	/** \brief Default maximal number of cuts returned by select: 500. */
+	static const int default_max_selected;
+
+	/** \brief Default value of reuse_ratio: 0.5. */
+	static const double default_reuse_ratio;
+
+	CutPool(int max_size = default_max_size, int max_age = default_max_age);
+
+	/**
+	 * \brief Identifier of the linearization of the constraint number \a constraint.
+	 */
+	static std::string source(int constraint);
+
+	/**
+	 * \brief Identifier of the linearization of the constraint number \a constraint at \a parameter.
+	 */
+	static std::string source(int constraint, const Vector& parameter);
+
+	/**
+	 * \brief Add the cut lhs*x <= rhs, valid on \a validity, which linearizes \a source.
+	 */
+	void add(const Vector& lhs, double rhs, const IntervalVector& validity, const std::string& source);
+
+	/**
+	 * \brief Append the strongest cuts valid on \a box to \a lhs and \a rhs.
+	 *
+	 * At most max_selected cuts with a positive efficacy on \a box are returned.
+	 * The sources of the cuts returned with a validity box close to \a box (see
+	 * reuse_ratio) are inserted in \a reused: they need not be linearized again.
+	 * Return the number of cuts appended.
+	 */
+	int select(const IntervalVector& box, std::vector<Vector>& lhs, std::vector<double>& rhs,
+			std::unordered_set<std::string>& reused);
+
+	int size() const;
+	void clear();
+
+	/** \brief Number of cuts added since the creation of the pool. */
+	long nb_added() const;
+
+	/** \brief Number of cuts returned by select since the creation of the pool. */
+	long nb_selected() const;
+
+	int max_size;
+	int max_age;
+	int max_selected;
+
+	/**
+	 * \brief A cut is reused instead of linearizing its source again if each
+	 * side of the box is at least this ratio of the side of its validity box.
+	 */
+	double reuse_ratio;
+
+private:
+	struct Cut {
+		Vector lhs;
+		double rhs;
+		double lhs_norm;
+		IntervalVector validity;
+		std::string source;
+		int age;
+		double efficacy;
+	};
+
+	static double efficacy(const Cut& cut, const IntervalVector& box);
+	bool reusable(const Cut& cut, const IntervalVector& box) const;
+	void purge();
+
+	mutable std::mutex mutex_;
+	std::vector<Cut> cuts_;
+	long nb_added_;
+	long nb_selected_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_CUTPOOL_H__
@@ -0,0 +1,85 @@
+/* ============================================================================
+ * I B E X - ibex_LPRowModel.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_LPRowModel.h"
+
+#include "ibex_CmpOp.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+const int LPRowModel::default_max_rows = 5000;
+
+LPRowModel::LPRowModel(LPSolver& lp_solver, int max_rows) :
+		max_rows(max_rows), lp_solver_(lp_solver), box_(1), nb_rows_by_origin_(POOL + 1, 0), first_row_(0), nb_kept_(0),
+		nb_rebuilt_(0) {
+	box_.set_empty();
+	first_row_ = 0;
+}
+
+void LPRowModel::begin(const IntervalVector& box) {
+	// The rows were generated on boxes containing box_
+	if (!box_.is_empty() && box_.size() == box.size() && box.is_subset(box_) && nb_rows() <= max_rows) {
+		++nb_kept_;
+	} else {
+		clear();
+		++nb_rebuilt_;
+	}
+	box_ = box;
+	first_row_ = nb_rows();
+}
+
+bool LPRowModel::add(const Vector& lhs, double rhs, Origin origin) {
+	string key(1, (char) origin);
+	key.append(reinterpret_cast<const char*>(&rhs), sizeof(rhs));
+	for (int j = 0; j < lhs.size(); ++j) {
+		const double value = lhs[j];
+		key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+	if (!rows_.insert(key).second) {
+		return false;
+	}
+	lp_solver_.add_constraint(lhs, CmpOp::LEQ, rhs);
+	++nb_rows_by_origin_[origin];
+	return true;
+}
+
+void LPRowModel::clear() {
+	lp_solver_.clear_constraints();
+	rows_.clear();
+	std::fill(nb_rows_by_origin_.begin(), nb_rows_by_origin_.end(), 0);
+	box_.set_empty();
+	first_row_ = 0;
+}
+
+int LPRowModel::nb_rows() const {
+	return rows_.size();
+}
+
+int LPRowModel::nb_rows(Origin origin) const {
+	return nb_rows_by_origin_[origin];
+}
+
+int LPRowModel::first_row() const {
+	return first_row_;
+}
+
+long LPRowModel::nb_kept() const {
+	return nb_kept_;
+}
+
+long LPRowModel::nb_rebuilt() const {
+	return nb_rebuilt_;
+}
+
+} // end namespace ibex
@@ -0,0 +1,119 @@
+/* ============================================================================
+ * I B E X - ibex_LPRowModel.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_LPROWMODEL_H__
+#define __SIP_IBEX_LPROWMODEL_H__
+
+#include "ibex_IntervalVector.h"
+#include "ibex_LPSolver.h"
+#include "ibex_Vector.h"
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \brief Rows of a linear relaxation kept in an LP solver from one node to the next.
+ *
+ * A row linearizes a constraint on a box and stays valid on every sub-box.
+ * The model remembers the box of the last relaxation: when the next box is
+ * a sub-box of it (a descendant of the node, or the same node again), the
+ * rows of the solver are kept, the new ones are appended and the rows
+ * already in the solver are not added twice. The solver then restarts from
+ * its previous basis. Otherwise, the rows are all removed.
+ *
+ * Each row is tagged by its origin. LPSolver cannot remove single rows: the
+ * rows are removed all at once, when the box leaves the lineage or when the
+ * solver holds more than max_rows rows.
+ *
+ * The rows added since the last call to begin are the rows of index
+ * first_row() and above; the rows below are those of the ancestors.
+ */
+class LPRowModel {
+public:
+	enum Origin {
+		NLC, SIC_PARAMETER_BOX, BLANKENSHIP_POINT, POOL
+	};
+
+	/**
+	 * \brief Default maximal number of rows kept: 5000.
+	 */
+	static const int default_max_rows;
+
+	/**
+	 * \brief Create a model of the rows of \a lp_solver.
+	 *
+	 * The rows of \a lp_solver must only be modified through *this.
+	 */
+	LPRowModel(LPSolver& lp_solver, int max_rows = default_max_rows);
+
+	/**
+	 * \brief Prepare a relaxation on \a box: keep the rows if they are valid on it, remove them otherwise.
+	 *
+	 * The bounds and the cost of the solver are left to the caller.
+	 */
+	void begin(const IntervalVector& box);
+
+	/**
+	 * \brief Add the row lhs*x <= rhs, valid on the box of begin.
+	 *
+	 * Return false if the solver already has this row (from the same origin).
+	 */
+	bool add(const Vector& lhs, double rhs, Origin origin);
+
+	/**
+	 * \brief Remove all the rows.
+	 */
+	void clear();
+
+	/**
+	 * \brief Number of rows of the solver.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Number of rows of the solver with origin \a origin.
+	 */
+	int nb_rows(Origin origin) const;
+
+	/**
+	 * \brief Index of the first row added since the last call to begin.
+	 *
+	 * Rows already in the solver and added again are not counted.
+	 */
+	int first_row() const;
+
+	/**
+	 * \brief Number of calls to begin that kept the rows, and that removed them.
+	 */
+	long nb_kept() const;
+	long nb_rebuilt() const;
+
+	/**
+	 * \brief Maximal number of rows kept by begin.
+	 */
+	int max_rows;
+
+private:
+	LPSolver& lp_solver_;
+	// Box of the last call to begin, empty if there are no rows
+	IntervalVector box_;
+	std::unordered_set<std::string> rows_;
+	std::vector<int> nb_rows_by_origin_;
+	int first_row_;
+	long nb_kept_;
+	long nb_rebuilt_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_LPROWMODEL_H__
@@ -0,0 +1,113 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterAscent.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ParameterAscent.h"
+
+#include "ibex_Function.h"
+#include "ibex_Interval.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+// Sufficient increase of the Armijo rule, and maximal number of halvings of a step
+const double armijo_slope = 1e-4;
+const int max_backtracks = 20;
+
+double max_abs(const Vector& v) {
+	double res = 0;
+	for (int i = 0; i < v.size(); ++i) {
+		res = std::max(res, std::fabs(v[i]));
+	}
+	return res;
+}
+}
+
+const int ParameterAscent::default_max_iterations = 50;
+const double ParameterAscent::default_tolerance = 1e-8;
+
+ParameterAscent::ParameterAscent(const SIConstraint& constraint, const IntervalVector& domain) :
+		max_iterations(default_max_iterations), tolerance(default_tolerance), constraint_(constraint),
+		domain_(domain) {
+}
+
+double ParameterAscent::evaluate(const Vector& x, const Vector& y, Vector& gradient) const {
+	IntervalVector full_point(constraint_.function_->nb_var());
+	full_point.put(0, x);
+	full_point.put(constraint_.variable_count_, y);
+	const Interval value = constraint_.function_->eval(full_point);
+	if (value.is_empty() || !std::isfinite(value.mid())) {
+		return NEG_INFINITY;
+	}
+	const IntervalVector full_gradient = constraint_.function_->gradient(full_point);
+	for (int k = 0; k < y.size(); ++k) {
+		gradient[k] = full_gradient[constraint_.variable_count_ + k].mid();
+		if (!std::isfinite(gradient[k])) {
+			gradient[k] = 0;
+		}
+	}
+	return value.mid();
+}
+
+Vector ParameterAscent::project(const Vector& y) const {
+	Vector res(y);
+	for (int k = 0; k < y.size(); ++k) {
+		res[k] = std::min(std::max(y[k], domain_[k].lb()), domain_[k].ub());
+	}
+	return res;
+}
+
+Vector ParameterAscent::maximize(const Vector& x, const Vector& start, double& value) const {
+	Vector y = project(start);
+	Vector gradient(y.size());
+	value = evaluate(x, y, gradient);
+	if (value == NEG_INFINITY || max_abs(gradient) == 0) {
+		return y;
+	}
+	// First step: a tenth of the domain along the gradient
+	double step = 0.1 * std::max(domain_.max_diam(), tolerance) / max_abs(gradient);
+	Vector new_gradient(y.size());
+	for (int iteration = 0; iteration < max_iterations; ++iteration) {
+		Vector new_y(y.size());
+		double new_value = NEG_INFINITY;
+		bool accepted = false;
+		for (int backtrack = 0; backtrack < max_backtracks; ++backtrack) {
+			new_y = project(y + step * gradient);
+			const Vector move = new_y - y;
+			if (max_abs(move) <= tolerance * (1 + max_abs(y))) {
+				return y;
+			}
+			new_value = evaluate(x, new_y, new_gradient);
+			if (new_value >= value + armijo_slope * (gradient * move)) {
+				accepted = true;
+				break;
+			}
+			step /= 2;
+		}
+		if (!accepted) {
+			return y;
+		}
+		// Barzilai-Borwein step, for the minimization of -g
+		const Vector s = new_y - y;
+		const Vector r = gradient - new_gradient;
+		const double curvature = s * r;
+		step = curvature > 0 ? (s * s) / curvature : 2 * step;
+		y = new_y;
+		value = new_value;
+		gradient = new_gradient;
+	}
+	return y;
+}
+
+} // end namespace ibex
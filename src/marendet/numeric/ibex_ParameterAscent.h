@@ -0,0 +1,66 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterAscent.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_PARAMETERASCENT_H__
+#define __SIP_IBEX_PARAMETERASCENT_H__
+
+#include "ibex_SIConstraint.h"
+
+#include "ibex_IntervalVector.h"
+#include "ibex_Vector.h"
+
+namespace ibex {
+
+/**
+ * \brief Local maximization of a semi-infinite constraint in the parameters.
+ *
+ * For a fixed x, maximize y -> g(x,y) on the parameter domain by projected
+ * gradient ascent. The step length is a Barzilai-Borwein (secant) estimate
+ * of the inverse curvature, safeguarded by an Armijo backtracking. Points
+ * are evaluated with the natural extension of g on degenerate boxes: no
+ * interval bisection is involved, the result is a local maximizer only.
+ */
+class ParameterAscent {
+public:
+	/** \brief Default maximal number of iterations of an ascent: 50. */
+	static const int default_max_iterations;
+
+	/** \brief Default relative length of the last step of an ascent: 1e-8. */
+	static const double default_tolerance;
+
+	/**
+	 * \brief Ascent on \a constraint, with the parameters in \a domain.
+	 */
+	ParameterAscent(const SIConstraint& constraint, const IntervalVector& domain);
+
+	/**
+	 * \brief Local maximizer of g(x,.) found from \a start, with its value in \a value.
+	 *
+	 * \a value is -oo if g cannot be evaluated at \a start.
+	 */
+	Vector maximize(const Vector& x, const Vector& start, double& value) const;
+
+	/** \brief Maximal number of iterations of an ascent. */
+	int max_iterations;
+
+	/** \brief An ascent stops when a step is shorter than tolerance*(1+|y|). */
+	double tolerance;
+
+private:
+	double evaluate(const Vector& x, const Vector& y, Vector& gradient) const;
+	Vector project(const Vector& y) const;
+
+	const SIConstraint& constraint_;
+	const IntervalVector domain_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_PARAMETERASCENT_H__
@@ -0,0 +1,142 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterBisector.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ParameterBisector.h"
+
+#include "ibex_utils.h"
+
+#include "ibex_Exception.h"
+
+#include <cmath>
+#include <utility>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+// Same threshold as bisectAllDim
+bool is_bisectable_dim(const Interval& param) {
+	return param.is_bisectable() && param.diam() > 1e-10;
+}
+}
+
+ParameterBisector::Policy ParameterBisector::default_policy = ParameterBisector::all_dims;
+
+ParameterBisector::ParameterBisector(int variable_count, Policy policy) :
+		variable_count_(variable_count), policy_(policy) {
+}
+
+ParameterBisector::Policy ParameterBisector::parse_policy(const string& name) {
+	if (name == "all") {
+		return all_dims;
+	} else if (name == "largest") {
+		return largest_first;
+	} else if (name == "smear") {
+		return smear;
+	} else if (name == "rr") {
+		return round_robin;
+	}
+	ibex_error(("unknown parameter bisection policy: " + name).c_str());
+	return all_dims;
+}
+
+bool ParameterBisector::bisect(ParameterPaving& paving, int i) const {
+	if (policy_ == all_dims) {
+		const int size = paving.size();
+		paving.bisect_all_dims(i);
+		return paving.size() > size;
+	}
+	const int dim = choose_dim(paving, i);
+	if (dim < 0) {
+		return false;
+	}
+	paving.bisect(i, dim);
+	return true;
+}
+
+vector<IntervalVector> ParameterBisector::children(const ParameterPaving& paving, int i) const {
+	const IntervalVector parameter_box = paving.parameter_box(i);
+	if (policy_ == all_dims) {
+		return bisectAllDim(parameter_box);
+	}
+	vector<IntervalVector> res;
+	const int dim = choose_dim(paving, i);
+	if (dim < 0) {
+		res.push_back(parameter_box);
+	} else {
+		pair<IntervalVector, IntervalVector> halves = parameter_box.bisect(dim);
+		res.push_back(halves.first);
+		res.push_back(halves.second);
+	}
+	return res;
+}
+
+int ParameterBisector::choose_dim(const ParameterPaving& paving, int i) const {
+	switch (policy_) {
+	case smear: {
+		int best_dim = -1;
+		double best_smear = 0;
+		for (int dim = 0; dim < paving.parameter_dim(); ++dim) {
+			const Interval param = paving.parameter(i, dim);
+			if (!is_bisectable_dim(param)) {
+				continue;
+			}
+			const Interval gradient = paving.gradient(i, variable_count_ + dim);
+			if (gradient.is_empty() || gradient.is_unbounded()) {
+				// Gradient unknown (e.g., box just bisected)
+				return largest_dim(paving, i);
+			}
+			const double dim_smear = gradient.mag() * param.diam();
+			if (best_dim < 0 || dim_smear > best_smear) {
+				best_dim = dim;
+				best_smear = dim_smear;
+			}
+		}
+		return best_dim;
+	}
+	case round_robin: {
+		const int p = paving.parameter_dim();
+		const int start = depth(paving, i) % p;
+		for (int k = 0; k < p; ++k) {
+			const int dim = (start + k) % p;
+			if (is_bisectable_dim(paving.parameter(i, dim))) {
+				return dim;
+			}
+		}
+		return -1;
+	}
+	default:
+		return largest_dim(paving, i);
+	}
+}
+
+int ParameterBisector::largest_dim(const ParameterPaving& paving, int i) const {
+	int best_dim = -1;
+	double best_diam = 0;
+	for (int dim = 0; dim < paving.parameter_dim(); ++dim) {
+		const Interval param = paving.parameter(i, dim);
+		if (is_bisectable_dim(param) && param.diam() > best_diam) {
+			best_dim = dim;
+			best_diam = param.diam();
+		}
+	}
+	return best_dim;
+}
+
+int ParameterBisector::depth(const ParameterPaving& paving, int i) const {
+	int res = 0;
+	for (int a = paving.parent(i); a >= 0; a = paving.ancestor_parent(a)) {
+		++res;
+	}
+	return res;
+}
+
+} // end namespace ibex
@@ -0,0 +1,84 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterBisector.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_PARAMETERBISECTOR_H__
+#define __SIP_IBEX_PARAMETERBISECTOR_H__
+
+#include "ibex_ParameterPaving.h"
+
+#include "ibex_IntervalVector.h"
+
+#include <string>
+#include <vector>
+
+namespace ibex {
+/**
+ * \brief ParameterBisector
+ *
+ * Bisection policy of the boxes of a parameter paving.
+ *
+ * all_dims bisects all the dimensions at once (2^p children, like bisectAllDim).
+ * The other policies bisect a single dimension (2 children):
+ * - largest_first: the dimension with the largest diameter,
+ * - smear: the dimension maximizing |df/dy_k| * diam(y_k), with the gradient
+ *   cached in the paving (largest_first if it is not known),
+ * - round_robin: the dimensions in turn, according to the depth of the box in
+ *   the bisection tree of the paving.
+ */
+class ParameterBisector {
+public:
+	enum Policy {
+		all_dims, largest_first, smear, round_robin
+	};
+
+	/**
+	 * \brief Policy used by default, e.g., by bisect_paving.
+	 */
+	static Policy default_policy;
+
+	/**
+	 * \param variable_count - number of variables x of the SIC (the gradients
+	 *                         in the paving are w.r.t. (x,y)).
+	 */
+	ParameterBisector(int variable_count, Policy policy = default_policy);
+
+	/**
+	 * \brief Bisect the box \a i of \a paving. The first child stays in row \a i,
+	 * the others are appended.
+	 *
+	 * Return false if the box is not bisected.
+	 */
+	bool bisect(ParameterPaving& paving, int i) const;
+
+	/**
+	 * \brief The children bisect would create, in the same order as the rows.
+	 */
+	std::vector<IntervalVector> children(const ParameterPaving& paving, int i) const;
+
+	/**
+	 * \brief Parse "all", "largest", "smear" or "rr".
+	 */
+	static Policy parse_policy(const std::string& name);
+
+private:
+	/**
+	 * \brief Dimension to bisect for single-dimension policies, -1 if none.
+	 */
+	int choose_dim(const ParameterPaving& paving, int i) const;
+	int largest_dim(const ParameterPaving& paving, int i) const;
+	int depth(const ParameterPaving& paving, int i) const;
+
+	const int variable_count_;
+	const Policy policy_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_PARAMETERBISECTOR_H__
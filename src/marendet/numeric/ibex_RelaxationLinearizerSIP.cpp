@@ -11,6 +11,7 @@
  
 #include "ibex_RelaxationLinearizerSIP.h"
 
+#include "ibex_ParameterPointPool.h"
 #include "ibex_utils.h"
 #include "ibex_SIConstraint.h"
 #include "ibex_SIConstraintCache.h"
@@ -18,6 +19,7 @@
 #include "ibex_CmpOp.h"
 #include "ibex_Interval.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 
@@ -27,10 +29,18 @@ namespace ibex {
 
 RelaxationLinearizerSIP::RelaxationLinearizerSIP(const SIPSystem& system, CornerPolicy corner_policy, bool opposite) :
 		Linearizer(system.ext_nb_var), system_(system), corner_policy_(corner_policy), opposite_(opposite), box_(
-				nb_var()) {
+				nb_var()), cut_pool_(nullptr), row_model_(nullptr) {
 
 }
 
+void RelaxationLinearizerSIP::set_cut_pool(CutPool* pool) {
+	cut_pool_ = pool;
+}
+
+void RelaxationLinearizerSIP::set_row_model(LPRowModel* model) {
+	row_model_ = model;
+}
+
 int RelaxationLinearizerSIP::linearize(const IntervalVector& box, LPSolver& lp_solver) {
 	ibex_error("RelaxationLinearizerSIP::linearize: called with no box_properties");
 	return -1;
@@ -45,23 +55,27 @@ int RelaxationLinearizerSIP::linearize(const IntervalVector& box, LPSolver& lp_s
 		ibex_error("RelaxationLinearizerSIP::linearize: BxpNodeData must be set");
 	}
 
-	int added_count = 0;
+	// Repeated linearizations of the node reuse the evaluations done on the same box
+	LinearizationCache& evaluations = node_data->linearization_cache;
+	evaluations.set_box(box);
 	box_ = box;
-	setCornersAndAlphas();
-	// NLConstraints
+	setCornersAndAlphas(evaluations);
 	std::vector<Vector> lhs;
 	std::vector<double> rhs;
-	for (const auto& nlc : system_.normal_constraints_) {
-		added_count += linearizeNLC(nlc, lhs, rhs);
-	}
-	int sic_index = 0;
-	for (const auto& sic : system_.sic_constraints_) {
-		added_count += linearizeSIC(sic, lhs, rhs, node_data->sic_constraints_caches[sic_index]);
-		sic_index++;
-	}
+	// Source of each new cut in the pool, empty for the cuts drawn from it
+	std::vector<std::string> sources;
+	std::vector<LPRowModel::Origin> origins;
+	int added_count = linearizeConstraints(*node_data, lhs, rhs, sources, origins);
 	for (int i = 0; i < rhs.size(); ++i) {
 		if (lhs[i].max() < 1e10 && lhs[i].min() > -1e10 && isfinite(lhs[i]) && std::isfinite(rhs[i])) {
-			lp_solver.add_constraint(lhs[i], CmpOp::LEQ, rhs[i]);
+			if (row_model_ != nullptr) {
+				row_model_->add(lhs[i], rhs[i], origins[i]);
+			} else {
+				lp_solver.add_constraint(lhs[i], CmpOp::LEQ, rhs[i]);
+			}
+			if (cut_pool_ != nullptr && !sources[i].empty()) {
+				cut_pool_->add(lhs[i], rhs[i], box, sources[i]);
+			}
 		} else {
 			added_count -= 1;
 		}
@@ -69,63 +83,141 @@ int RelaxationLinearizerSIP::linearize(const IntervalVector& box, LPSolver& lp_s
 	return added_count;
 }
 
-int RelaxationLinearizerSIP::linearizeNLC(const NLConstraint& nlc, std::vector<Vector>& lhs,
-		std::vector<double>& rhs) const {
+int RelaxationLinearizerSIP::linearizeConstraints(BxpNodeData& node_data, std::vector<Vector>& lhs,
+		std::vector<double>& rhs, std::vector<std::string>& sources, std::vector<LPRowModel::Origin>& origins) const {
+	LinearizationCache& evaluations = node_data.linearization_cache;
+	std::unordered_set<std::string> reused;
 	int added_count = 0;
-	for (int i = 0; i < alphas_.size(); ++i) {
-		Interval function_value = nlc.evaluate(corners_[i]);
-		IntervalVector gradient = nlc.gradient(box_);
-		double rhs_param = -function_value.lb();
-		Vector lhs_param(nb_var());
-		for (int j = 0; j < nb_var(); ++j) {
-			lhs_param[j] = alphas_[i][j] == 0 ? gradient[j].lb() : gradient[j].ub();
-			rhs_param += (Interval(lhs_param[j]) * corners_[i][j]).lb();
+	if (cut_pool_ != nullptr) {
+		added_count += cut_pool_->select(box_, lhs, rhs, reused);
+	}
+	sources.resize(lhs.size());
+	origins.resize(lhs.size(), LPRowModel::POOL);
+	// Constraints are numbered as in the system: first the NLCs, then the SICs
+	int constraint = 0;
+	for (const auto& nlc : system_.normal_constraints_) {
+		const std::string source = cut_pool_ != nullptr ? CutPool::source(constraint) : std::string();
+		if (reused.count(source) == 0) {
+			added_count += linearizeNLC(constraint, nlc, lhs, rhs, evaluations);
+			sources.resize(lhs.size(), source);
+			origins.resize(lhs.size(), LPRowModel::NLC);
 		}
-		added_count += 1;
-		lhs.emplace_back(lhs_param);
-		rhs.emplace_back(rhs_param);
+		++constraint;
+	}
+	int sic_index = 0;
+	for (const auto& sic : system_.sic_constraints_) {
+		const SIConstraintCache& cache = node_data.sic_constraints_caches[sic_index];
+		const ParameterPaving& paving = cache.parameter_caches_;
+		std::vector<Vector> parameter_points;
+		for (int k = 0; k < paving.size(); ++k) {
+			parameter_points.emplace_back(paving.parameter_mid(k));
+		}
+		const int nb_mids = parameter_points.size();
+		parameter_points.insert(parameter_points.end(), cache.best_blankenship_points_.begin(),
+				cache.best_blankenship_points_.end());
+		// Worst-case parameters found in the other nodes
+		ParameterPointPool* pool = system_.parameter_point_pool;
+		if (pool != nullptr) {
+			for (const Vector& point : pool->select(sic_index, box_.subvector(0, sic.variable_count_ - 1),
+					pool->nb_seeds)) {
+				if (std::find(parameter_points.begin() + nb_mids, parameter_points.end(), point)
+						== parameter_points.end()) {
+					parameter_points.push_back(point);
+				}
+			}
+		}
+		for (int k = 0; k < (int) parameter_points.size(); ++k) {
+			const Vector& parameter_point = parameter_points[k];
+			const std::string source =
+					cut_pool_ != nullptr ? CutPool::source(constraint, parameter_point) : std::string();
+			if (reused.count(source) == 0) {
+				added_count += linearizeSICAtParameter(constraint, sic, parameter_point, lhs, rhs, evaluations);
+				sources.resize(lhs.size(), source);
+				origins.resize(lhs.size(), k < nb_mids ? LPRowModel::SIC_PARAMETER_BOX : LPRowModel::BLANKENSHIP_POINT);
+			}
+		}
+		++constraint;
+		++sic_index;
 	}
 	return added_count;
 }
 
-int RelaxationLinearizerSIP::linearizeSIC(const SIConstraint& constraint, std::vector<Vector>& lhs,
-		std::vector<double>& rhs, SIConstraintCache& cache) const {
+int RelaxationLinearizerSIP::linearizeNLC(int index, const NLConstraint& nlc, std::vector<Vector>& lhs,
+		std::vector<double>& rhs, LinearizationCache& evaluations) const {
+	LinearizationCache::Entry& entry = evaluations.entry(index);
+	// The gradient on the box does not depend on the corner
+	if (!entry.has_gradient) {
+		entry.gradient = nlc.gradient(box_);
+		entry.has_gradient = true;
+	}
+	std::vector<Interval> corner_values;
+	for (const Vector& corner : corners_) {
+		const Interval* value = entry.value(corner);
+		if (value == nullptr) {
+			entry.set_value(corner, nlc.evaluate(corner));
+			value = entry.value(corner);
+		}
+		corner_values.emplace_back(*value);
+	}
+	addCuts(entry.gradient, corner_values, lhs, rhs);
+	return corners_.size();
+}
+
+int RelaxationLinearizerSIP::linearizeSIC(int index, const SIConstraint& constraint, std::vector<Vector>& lhs,
+		std::vector<double>& rhs, SIConstraintCache& cache, LinearizationCache& evaluations) const {
 	int added_count = 0;
-	for (int i = 0; i < alphas_.size(); ++i) {
-		for (const auto& mem_box : cache.parameter_caches_) {
-			Interval function_value = constraint.evaluate(corners_[i], mem_box.parameter_box.mid());
-			IntervalVector gradient = constraint.gradient(box_, mem_box.parameter_box.mid());
-			double rhs_param = -function_value.lb();
-			//std::cout << function_value << std::endl;
-			Vector lhs_param(nb_var());
-			for (int j = 0; j < nb_var(); ++j) {
-				lhs_param[j] = alphas_[i][j] == 0 ? gradient[j].lb() : gradient[j].ub();
-				rhs_param += (Interval(lhs_param[j]) * corners_[i][j]).lb();
-			}
-			added_count += 1;
-			lhs.emplace_back(lhs_param);
-			rhs.emplace_back(rhs_param);
+	const ParameterPaving& paving = cache.parameter_caches_;
+	for (int k = 0; k < paving.size(); ++k) {
+		added_count += linearizeSICAtParameter(index, constraint, paving.parameter_mid(k), lhs, rhs, evaluations);
+	}
+	for (const auto& parameter_point : cache.best_blankenship_points_) {
+		added_count += linearizeSICAtParameter(index, constraint, parameter_point, lhs, rhs, evaluations);
+	}
+	return added_count;
+}
+
+int RelaxationLinearizerSIP::linearizeSICAtParameter(int index, const SIConstraint& constraint,
+		const Vector& parameter_point, std::vector<Vector>& lhs, std::vector<double>& rhs,
+		LinearizationCache& evaluations) const {
+	LinearizationCache::Entry& entry = evaluations.entry(index, parameter_point);
+	// The gradient on the box does not depend on the corner
+	if (!entry.has_gradient) {
+		entry.gradient = constraint.gradient(box_, parameter_point);
+		entry.has_gradient = true;
+	}
+	std::vector<Interval> corner_values;
+	for (const Vector& corner : corners_) {
+		const Interval* value = entry.value(corner);
+		if (value == nullptr) {
+			// Point evaluation: centeredFormEval reduces to the natural extension
+			entry.set_value(corner, constraint.evaluate(corner, parameter_point));
+			value = entry.value(corner);
 		}
-		for (const auto& parameter_point : cache.best_blankenship_points_) {
-			Interval function_value = constraint.evaluate(corners_[i], parameter_point);
-			IntervalVector gradient = constraint.gradient(box_, parameter_point);
-			double rhs_param = -function_value.lb();
-			Vector lhs_param(nb_var());
-			for (int j = 0; j < nb_var(); ++j) {
-				lhs_param[j] = alphas_[i][j] == 0 ? gradient[j].lb() : gradient[j].ub();
-				rhs_param += (Interval(lhs_param[j]) * corners_[i][j]).lb();
-			}
-			added_count += 1;
-			lhs.emplace_back(lhs_param);
-			rhs.emplace_back(rhs_param);
+		corner_values.emplace_back(*value);
+	}
+	addCuts(entry.gradient, corner_values, lhs, rhs);
+	return corners_.size();
+}
+
+void RelaxationLinearizerSIP::addCuts(const IntervalVector& gradient, const std::vector<Interval>& corner_values,
+		std::vector<Vector>& lhs, std::vector<double>& rhs) const {
+	for (int i = 0; i < alphas_.size(); ++i) {
+		double rhs_param = -corner_values[i].lb();
+		Vector lhs_param(nb_var());
+		for (int j = 0; j < nb_var(); ++j) {
+			lhs_param[j] = alphas_[i][j] == 0 ? gradient[j].lb() : gradient[j].ub();
+			rhs_param += (Interval(lhs_param[j]) * corners_[i][j]).lb();
 		}
+		lhs.emplace_back(lhs_param);
+		rhs.emplace_back(rhs_param);
 	}
-	return added_count;
 }
 
-void RelaxationLinearizerSIP::setCornersAndAlphas() {
+void RelaxationLinearizerSIP::setCornersAndAlphas(LinearizationCache& evaluations) {
 	corners_.clear();
 	alphas_.clear();
+	// A random corner is drawn once per box, so that its values can be reused
+	const bool drawn = corner_policy_ == random && (int) evaluations.alpha.size() == nb_var();
 	std::vector<int> alpha(nb_var());
 	Vector corner(nb_var());
 	for (int i = 0; i < nb_var(); ++i) {
@@ -140,11 +232,14 @@ void RelaxationLinearizerSIP::setCornersAndAlphas() {
 			corner[i] = box_[i].lb();
 			break;
 		case random:
-			alpha[i] = rand() % 2;
+			alpha[i] = drawn ? evaluations.alpha[i] : system_.random_engine()() % 2;
 			corner[i] = (1 - alpha[i]) * box_[i].lb() + alpha[i] * box_[i].ub();
 			break;
 		}
 	}
+	if (corner_policy_ == random) {
+		evaluations.alpha = alpha;
+	}
 	alphas_.emplace_back(alpha);
 	corners_.emplace_back(corner);
 	// Then, check if the opposite flag is set
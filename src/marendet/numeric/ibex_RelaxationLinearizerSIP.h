@@ -12,6 +12,9 @@
 #ifndef __SIP_IBEX_RELAXATIONLINEARIZERSIP_H__
 #define __SIP_IBEX_RELAXATIONLINEARIZERSIP_H__
 
+#include "ibex_CutPool.h"
+#include "ibex_LinearizationCache.h"
+#include "ibex_LPRowModel.h"
 #include "ibex_NLConstraint.h"
 #include "ibex_SIPSystem.h"
 
@@ -20,6 +23,8 @@
 #include "ibex_LPSolver.h"
 #include "ibex_Vector.h"
 
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace ibex {
@@ -38,18 +43,56 @@ public:
 			CornerPolicy corner_policy, bool opposite);
 	int linearize(const IntervalVector& box, LPSolver& lp_solver);
 	int linearize(const IntervalVector& box, LPSolver& lp_solver, BoxProperties& prop);
-	int linearizeNLC(const NLConstraint& constraint,
-			std::vector<Vector>& lhs, std::vector<double>& rhs) const;
-	int linearizeSIC(const SIConstraint& constraint,
-			std::vector<Vector>& lhs, std::vector<double>& rhs, SIConstraintCache& cache) const;
+	/**
+	 * \brief Linearize the NLC number \a index of the system.
+	 *
+	 * The gradient and the corner values are read from \a evaluations when they
+	 * were computed on the same box, and stored in it otherwise.
+	 */
+	int linearizeNLC(int index, const NLConstraint& constraint,
+			std::vector<Vector>& lhs, std::vector<double>& rhs, LinearizationCache& evaluations) const;
+	/**
+	 * \brief Linearize the SIC number \a index of the system, at the parameter points of \a cache.
+	 *
+	 * See linearizeNLC for \a evaluations.
+	 */
+	int linearizeSIC(int index, const SIConstraint& constraint,
+			std::vector<Vector>& lhs, std::vector<double>& rhs, SIConstraintCache& cache,
+			LinearizationCache& evaluations) const;
+
+	/**
+	 * \brief Draw cuts from \a pool and store the new ones in it (nullptr: no pool).
+	 *
+	 * The cuts of the pool valid on the box are added to the LP, the strongest
+	 * first. A constraint (at a parameter point, for a SIC) is linearized again
+	 * only if the pool has no cut of it generated on a box close enough (see
+	 * CutPool::reuse_ratio). The new cuts are stored with the box as validity.
+	 */
+	void set_cut_pool(CutPool* pool);
+
+	/**
+	 * \brief Add the rows through \a model (nullptr: directly to the LP solver).
+	 *
+	 * \a model must wrap the LP solver given to linearize. The rows are tagged
+	 * by their origin, and the rows already in the solver are not added again.
+	 */
+	void set_row_model(LPRowModel* model);
 private:
-	void setCornersAndAlphas();
+	int linearizeConstraints(BxpNodeData& node_data, std::vector<Vector>& lhs, std::vector<double>& rhs,
+			std::vector<std::string>& sources, std::vector<LPRowModel::Origin>& origins) const;
+	int linearizeSICAtParameter(int index, const SIConstraint& constraint, const Vector& parameter_point,
+			std::vector<Vector>& lhs, std::vector<double>& rhs, LinearizationCache& evaluations) const;
+	void addCuts(const IntervalVector& gradient, const std::vector<Interval>& corner_values,
+			std::vector<Vector>& lhs, std::vector<double>& rhs) const;
+	void setCornersAndAlphas(LinearizationCache& evaluations);
 	const SIPSystem& system_;
 	const CornerPolicy corner_policy_;
 	const bool opposite_;
 	IntervalVector box_;
 	std::vector<Vector> corners_;
 	std::vector<std::vector<int>> alphas_;
+	CutPool* cut_pool_;
+	LPRowModel* row_model_;
 
 };
 
@@ -46,7 +46,10 @@ int RestrictionLinearizerSIP::linearize(const IntervalVector& box, LPSolver& lp_
 	if(node_data == nullptr) {
 		ibex_error("RelaxationLinearizerSIP::linearize: BxpNodeData must be set");
 	}
-    
+	return linearize(box, lp_solver, *node_data);
+}
+
+int RestrictionLinearizerSIP::linearize(const IntervalVector& box, LPSolver& lp_solver, BxpNodeData& node_data) {
     int added_count = 0;
     box_ = box;
     setCornerAndAlpha();
@@ -63,7 +66,7 @@ int RestrictionLinearizerSIP::linearize(const IntervalVector& box, LPSolver& lp_
     std::vector<Vector> lhs_sic;
     std::vector<double> rhs_sic;
     for(int i = 0; i < system_.sic_constraints_.size(); ++i) {
-        added_count += linearizeSIC(system_.sic_constraints_[i], lhs_sic, rhs_sic, node_data->sic_constraints_caches[i]);
+        added_count += linearizeSIC(system_.sic_constraints_[i], lhs_sic, rhs_sic, node_data.sic_constraints_caches[i]);
     }
     for(int i = 0; i < rhs_sic.size(); ++i) {
         if(lhs_sic[i].max() > 1e10 || lhs_sic[i].min() < -1e10 || !isfinite(lhs_sic[i]) || !std::isfinite(rhs_sic[i])) {
@@ -90,10 +93,11 @@ int RestrictionLinearizerSIP::linearizeSIC(const SIConstraint& constraint, std::
     int added_count = 0;
     // TODO : Sale. Peut etre une fonction getUpdatedCache dans SIConstraint ?
     cache.update_cache(*constraint.function_, box_);
-    for(const auto& mem_box : cache.parameter_caches_) {
-    	Interval function_value = constraint.evaluate(corner_, mem_box.parameter_box);
+    const ParameterPaving& paving = cache.parameter_caches_;
+    for(int k = 0; k < paving.size(); ++k) {
+    	Interval function_value = constraint.evaluate(corner_, paving.parameter_box(k));
         //Interval function_value = mem_box.evaluation;
-        IntervalVector gradient = mem_box.full_gradient;
+        IntervalVector gradient = paving.full_gradient(k);
         double rhs_param = -function_value.ub();
         Vector lhs_param(nb_var());
         for(int i = 0; i < nb_var(); ++i) {
@@ -120,7 +124,7 @@ void RestrictionLinearizerSIP::setCornerAndAlpha() {
                 corner_[i] = box_[i].lb();
                 break;
             case random:
-                alpha_[i] = rand() % 2;
+                alpha_[i] = system_.random_engine()() % 2;
                 corner_[i] = (1-alpha_[i])*box_[i].lb() + alpha_[i]*box_[i].ub();
                 break;
         }
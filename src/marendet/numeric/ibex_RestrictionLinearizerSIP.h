@@ -36,6 +36,12 @@ public:
 			CornerPolicy corner_policy);
 	int linearize(const IntervalVector& box, LPSolver& lp_solver);
 	int linearize(const IntervalVector& box, LPSolver& lp_solver, BoxProperties& prop);
+	/**
+	 * \brief Same as linearize(box, lp_solver, prop), with the node data of prop given directly.
+	 *
+	 * The caches of \a node_data are updated on \a box.
+	 */
+	int linearize(const IntervalVector& box, LPSolver& lp_solver, BxpNodeData& node_data);
 	int linearizeNLC(const NLConstraint& constraint, Vector& lhs,
 			double& rhs) const;
 	int linearizeSIC(const SIConstraint& constraint,
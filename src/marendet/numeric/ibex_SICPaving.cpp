@@ -11,193 +11,483 @@
  
 #include "ibex_SICPaving.h"
 
+#include "ibex_ParameterAscent.h"
+#include "ibex_ParameterPointPool.h"
 #include "ibex_SIPSystem.h"
+#include "ibex_ParameterPavingEvaluator.h"
 
 #include "ibex_utils.h"
+#include "ibex_PavingThreadPool.h"
 #include "ibex_Newton.h"
 #include "ibex_Linear.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <queue>
+#include <utility>
+#include <vector>
+
 namespace ibex {
 
-void bisect_paving(SIConstraintCache& cache) {
+void bisect_paving(SIConstraintCache& cache, const ParameterBisector& bisector) {
+	// Sequential: bisecting only moves rows, the evaluation of the new rows is parallel
 	const int cache_size = cache.parameter_caches_.size();
 	for(int i = 0; i < cache_size; ++i) {
-		auto bisects = bisectAllDim(cache.parameter_caches_[i].parameter_box);
-		cache.parameter_caches_[i] = ParameterEvaluationsCache(bisects[0]);
-		for(int j = 1; j < bisects.size(); ++j) {
-			cache.parameter_caches_.emplace_back(ParameterEvaluationsCache(bisects[j]));
+		bisector.bisect(cache.parameter_caches_, i);
+	}
+}
+
+bool is_feasible_with_paving(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box) {
+	ParameterPavingEvaluator evaluator(*constraint.function_, constraint.variable_count_, &cache.ancestor_bounds_);
+	evaluator.set_box(box);
+	return evaluator.is_satisfied(cache.parameter_caches_);
+}
+
+namespace {
+
+// Apply the monotonicity filter on the row i. Return false if the row can be removed.
+bool monotonicity_keep(const SIConstraint& constraint, const IntervalVector& paramBoxUnion, ParameterPaving& list, int i) {
+	bool keepInVector = true;
+	for (int paramCount = 0; paramCount < list.parameter_dim(); ++paramCount) {
+		int paramIndex = paramCount + constraint.variable_count_;
+		const Interval gradient = list.gradient(i, paramIndex);
+		const Interval param = list.parameter(i, paramCount);
+		if (gradient.lb() > 0) {
+			list.set_parameter(i, paramCount, param.ub());
+			if (param.ub() < paramBoxUnion[paramCount].ub()) {
+				keepInVector = false;
+			}
+		} else if (gradient.ub() < 0) {
+			list.set_parameter(i, paramCount, param.lb());
+			if (param.lb() > paramBoxUnion[paramCount].lb()) {
+				keepInVector = false;
+			}
 		}
 	}
+	return keepInVector;
 }
 
-bool is_feasible_with_paving(const SIConstraint& constraint, const SIConstraintCache& cache, const IntervalVector& box) {
-	const auto& list = cache.parameter_caches_;
-	for(int i = 0; i < list.size(); ++i) {
-		if(constraint.evaluate(box, list[i].parameter_box).ub() > 0) {
-			return false;
+/*
+ * True if the monotonicity filter removes an ancestor of the row i, with all
+ * the rows below it: the constraint is monotonic in a parameter on the
+ * ancestor, whose worst face is inside the initial box.
+ */
+bool monotonicity_removes_ancestor(ParameterPavingEvaluator& evaluator, const SIConstraint& constraint,
+		const IntervalVector& paramBoxUnion, const ParameterPaving& list, int i, int slot) {
+	for (int a = list.parent(i); a >= 0; a = list.ancestor_parent(a)) {
+		const IntervalVector* gradient = evaluator.ancestor_gradient(list, a, slot);
+		if (gradient == nullptr) {
+			continue;
+		}
+		for (int paramCount = 0; paramCount < list.parameter_dim(); ++paramCount) {
+			const Interval& derivative = (*gradient)[paramCount + constraint.variable_count_];
+			const Interval param = list.ancestor_parameter(a, paramCount);
+			if ((derivative.lb() > 0 && param.ub() < paramBoxUnion[paramCount].ub())
+					|| (derivative.ub() < 0 && param.lb() > paramBoxUnion[paramCount].lb())) {
+				return true;
+			}
 		}
 	}
-	return true;
+	return false;
 }
 
-void simplify_paving(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box, bool with_newton) {
-    cache.update_cache(*constraint.function_, box, true);
-	monotonicity_filter(constraint, cache, box);
-    evaluation_filter(constraint, cache, box);
-    if(with_newton) {
-        newton_filter(constraint, cache, box);
-    }
+// Apply the monotonicity filter on all the rows, by their ancestors first. Return the rows removed.
+std::vector<char> monotonic_rows(const SIConstraint& constraint, SIConstraintCache& cache, ParameterPavingEvaluator& evaluator) {
+	auto& list = cache.parameter_caches_;
+	PavingThreadPool& pool = PavingThreadPool::global();
+	evaluator.prepare_ancestors(list, true);
+	evaluator.prepare_slots(pool, pool.nb_slots(list.size()));
+	std::vector<char> monotonic(list.size());
+	list.prepare_concurrent_writes(0);
+	pool.parallel_for(list.size(), [&](int begin, int end, int slot) {
+		for (int i = begin; i < end; ++i) {
+			monotonic[i] = monotonicity_removes_ancestor(evaluator, constraint, cache.initial_box_, list, i, slot)
+					|| !monotonicity_keep(constraint, cache.initial_box_, list, i);
+		}
+	});
+	return monotonic;
 }
 
+/*
+ * Newton filter of the boxes, with the workspace shared by all the boxes
+ * of a slot. \a function is the function of the constraint or a copy of it.
+ */
+class NewtonRowFilter {
+public:
+	NewtonRowFilter(const SIConstraint& constraint, const Function& function, const IntervalVector& box) :
+			constraint_(constraint), function_(function), box_(box),
+			fullbox_(constraint.variable_count_ + constraint.parameter_count_),
+			bitset_(parameter_bitset(constraint, fullbox_.size())), vars_(fullbox_.size(), bitset_),
+			full_hessian_(vars_.nb_var, fullbox_.size()), param_hessian_(vars_.nb_var, vars_.nb_var),
+			h_(vars_.nb_var) {
+	}
 
-void monotonicity_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box) {
-	auto& list = cache.parameter_caches_;
-    auto it = list.begin();
-    IntervalVector paramBoxUnion = cache.initial_box_;
-    while (it != list.end()) {
-		bool keepInVector = true;
-		for (int paramCount = 0; paramCount < it->parameter_box.size(); ++paramCount) {
-			int paramIndex = paramCount + constraint.variable_count_;
-			if (it->full_gradient[paramIndex].lb() > 0) {
-				it->parameter_box[paramCount] = it->parameter_box[paramCount].ub();
-				if (it->parameter_box[paramCount].ub() < paramBoxUnion[paramCount].ub()) {
-					keepInVector = false;
-				} else {
-					// TODO Maybe update only at the end
-					//_updateMemoryBox(*it);
-				}
-			} else if (it->full_gradient[paramIndex].ub() < 0) {
-				it->parameter_box[paramCount] = it->parameter_box[paramCount].lb();
-				if (it->parameter_box[paramCount].lb() > paramBoxUnion[paramCount].lb()) {
-					keepInVector = false;
-				} else {
-					//_updateMemoryBox(*it);
+	/*
+	 * Contract parameter_box to its points where the gradient w.r.t. the
+	 * parameters may vanish. Return false if there is none.
+	 */
+	bool contract(IntervalVector& parameter_box) {
+		fullbox_ = vars_.full_box(parameter_box, box_);
+		const Vector parameter_mid = parameter_box.mid();
+		IntervalVector fullbox_mid = vars_.full_box(parameter_mid, box_);
+		IntervalVector param_gradient = vars_.var_box(function_.gradient(fullbox_mid));
+		for(int k = 0; k < vars_.nb_var; ++k) {
+			function_.diff().jacobian(fullbox_, full_hessian_, bitset_, vars_.var(k));
+		}
+		for(int k = 0; k < vars_.nb_var; ++k) {
+			param_hessian_.set_row(k, vars_.var_box(full_hessian_.row(k)));
+		}
+		h_ = parameter_box - parameter_mid;
+		try {
+			precond(param_hessian_, param_gradient);
+		} catch(...) {
+			//ibex_warning("Precond failed in newton_filter");
+		}
+		gauss_seidel(param_hessian_, -param_gradient, h_);
+		parameter_box = h_ + parameter_mid;
+		return !h_.is_empty();
+	}
+
+private:
+	static BitSet parameter_bitset(const SIConstraint& constraint, int size) {
+		BitSet bitset(size);
+		for (int i = constraint.variable_count_; i < size; ++i) {
+			bitset.add(i);
+		}
+		return bitset;
+	}
+
+	const SIConstraint& constraint_;
+	const Function& function_;
+	const IntervalVector& box_;
+	IntervalVector fullbox_;
+	BitSet bitset_;
+	VarSet vars_;
+	IntervalMatrix full_hessian_;
+	IntervalMatrix param_hessian_;
+	IntervalVector h_;
+};
+
+// Filter which removed a row
+enum RowFate : char { kept_row, removed_by_monotonicity, removed_by_evaluation, removed_by_newton };
+
+/*
+ * Compute fate(i, slot) for all the rows, in chunks processed in parallel
+ * by the PavingThreadPool if the paving is large enough, then compact the
+ * rows kept at the beginning. Each filter only depends on the row it is
+ * applied on.
+ */
+template<typename Fate>
+PavingFilterStats filter_rows(ParameterPaving& list, const Fate& fate) {
+	std::vector<char> fates(list.size());
+	list.prepare_concurrent_writes(0);
+	PavingThreadPool::global().parallel_for(list.size(), [&](int begin, int end, int slot) {
+		for (int i = begin; i < end; ++i) {
+			fates[i] = fate(i, slot);
+		}
+	});
+	PavingFilterStats stats;
+	int kept = 0;
+	for (int i = 0; i < list.size(); ++i) {
+		switch (fates[i]) {
+		case removed_by_monotonicity:
+			stats.monotonicity++;
+			break;
+		case removed_by_evaluation:
+			stats.evaluation++;
+			break;
+		case removed_by_newton:
+			stats.newton++;
+			break;
+		default:
+			list.copy_row(i, kept++);
+		}
+	}
+	list.truncate(kept);
+	return stats;
+}
+
+/*
+ * Newton filter of a paving, with one NewtonRowFilter per slot. A row
+ * interior to the initial box is first intersected with the contractions of
+ * its ancestors interior to it, top-down, then contracted itself. Since an
+ * ancestor contains the rows below it, its contraction keeps their
+ * stationary points: it is computed once, by the first row reaching it, and
+ * removes at once all the rows below it if it is empty.
+ */
+class PavingNewton {
+public:
+	PavingNewton(const SIConstraint& constraint, const SIConstraintCache& cache, const IntervalVector& box,
+			const ParameterPaving& list) :
+			paramBoxUnion_(cache.initial_box_), rows_below_(list.ancestor_count(), 0),
+			states_(list.ancestor_count()), contractions_(list.ancestor_count(), IntervalVector(list.parameter_dim())) {
+		PavingThreadPool& pool = PavingThreadPool::global();
+		for (int slot = 0; slot < pool.nb_slots(list.size()); ++slot) {
+			filters_.emplace_back(new NewtonRowFilter(constraint, pool.replica(*constraint.function_, slot), box));
+			paths_.emplace_back();
+		}
+		for (int i = 0; i < list.size(); ++i) {
+			for (int a = list.parent(i); a >= 0; a = list.ancestor_parent(a)) {
+				++rows_below_[a];
+			}
+		}
+		for (std::atomic<int>& state : states_) {
+			state.store(unknown);
+		}
+	}
+
+	// Contract the row i in the slot slot. Return false if it can be removed.
+	bool keep(ParameterPaving& list, int i, int slot) {
+		IntervalVector parameter_box = list.parameter_box(i);
+		if(!parameter_box.is_interior_subset(paramBoxUnion_)) {
+			return true;
+		}
+		std::vector<int>& path = paths_[slot];
+		path.clear();
+		for (int a = list.parent(i); a >= 0; a = list.ancestor_parent(a)) {
+			path.push_back(a);
+		}
+		for (auto it = path.rbegin(); it != path.rend(); ++it) {
+			const IntervalVector* contraction = ancestor_contraction(list, *it, slot);
+			if (contraction != nullptr) {
+				parameter_box &= *contraction;
+				if (parameter_box.is_empty()) {
+					return false;
 				}
 			}
 		}
-		if (!keepInVector) {
-			it = list.erase(it);
-		} else {
-			//_updateMemoryBox(*it);
-			++it;
+		const bool kept = filters_[slot]->contract(parameter_box);
+		list.set_parameter_box(i, parameter_box);
+		return kept;
+	}
+
+private:
+	enum State : int { unknown, busy, contracted, not_contracted };
+
+	// Contraction of the ancestor a, null if it is not available
+	const IntervalVector* ancestor_contraction(const ParameterPaving& list, int a, int slot) {
+		// Contracting an ancestor of a single row cannot save anything
+		if (a >= (int) rows_below_.size() || rows_below_[a] < 2) {
+			return nullptr;
 		}
+		int state = states_[a].load();
+		if (state == unknown && states_[a].compare_exchange_strong(state, busy)) {
+			IntervalVector& contraction = contractions_[a];
+			for (int dim = 0; dim < list.parameter_dim(); ++dim) {
+				contraction[dim] = list.ancestor_parameter(a, dim);
+			}
+			if (contraction.is_interior_subset(paramBoxUnion_)) {
+				filters_[slot]->contract(contraction);
+				state = contracted;
+			} else {
+				state = not_contracted;
+			}
+			states_[a].store(state);
+		}
+		return state == contracted ? &contractions_[a] : nullptr;
 	}
+
+	const IntervalVector& paramBoxUnion_;
+	std::vector<std::unique_ptr<NewtonRowFilter>> filters_;
+	// Ancestors of the current row of each slot, bottom-up
+	std::vector<std::vector<int>> paths_;
+	std::vector<int> rows_below_;
+	std::vector<std::atomic<int>> states_;
+	std::vector<IntervalVector> contractions_;
+};
+
 }
 
-void evaluation_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box) {
-    auto& list = cache.parameter_caches_;
-    auto it = list.begin();
-	while (it != list.end()) {
-		if (constraint.evaluate(box, it->parameter_box).ub() <= 0) {
-			it = list.erase(it);
-		} else {
-			it++;
+void simplify_paving(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box, bool with_newton,
+		PavingFilterStats* stats) {
+	cache.update_cache(*constraint.function_, box, true);
+	auto& list = cache.parameter_caches_;
+	ParameterPavingEvaluator evaluator(*constraint.function_, constraint.variable_count_, &cache.ancestor_bounds_);
+	evaluator.set_box(box);
+	// The monotonicity filter moves the parameters of the rows it keeps: it runs first
+	const std::vector<char> monotonic = monotonic_rows(constraint, cache, evaluator);
+	// The evaluation is batched over the other rows
+	std::vector<char> satisfied;
+	evaluator.mark_satisfied(list, satisfied, &monotonic);
+	std::unique_ptr<PavingNewton> newton;
+	if (with_newton) {
+		newton.reset(new PavingNewton(constraint, cache, box, list));
+	}
+	const PavingFilterStats local_stats = filter_rows(list, [&](int i, int slot) {
+		if (monotonic[i]) {
+			return removed_by_monotonicity;
+		} else if (satisfied[i]) {
+			return removed_by_evaluation;
+		} else if (with_newton && !newton->keep(list, i, slot)) {
+			return removed_by_newton;
 		}
+		return kept_row;
+	});
+	if (stats != nullptr) {
+		*stats += local_stats;
 	}
 }
 
-void newton_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box) {
-    auto& list = cache.parameter_caches_;
-    auto it = list.begin();
-    IntervalVector paramBoxUnion = cache.initial_box_;
-    IntervalVector fullbox(constraint.variable_count_ + constraint.parameter_count_);
-    //fullbox.put(0, box);
-    BitSet bitset(fullbox.size());
-    for(int i = constraint.variable_count_; i < fullbox.size(); ++i) {
-        bitset.add(i);
-    }
-    VarSet vars(fullbox.size(), bitset);
-
-	//IntervalVector param_gradient(vars.nb_var);
-	IntervalMatrix full_hessian(vars.nb_var, fullbox.size());
-	IntervalMatrix param_hessian(vars.nb_var, vars.nb_var);
-	IntervalVector h(vars.nb_var);
-
-
-    while(it != list.end()) {
-        if(!it->parameter_box.is_interior_subset(paramBoxUnion)) {
-			it++;
-            continue;
-        }
-		fullbox = vars.full_box(it->parameter_box, box);
-		IntervalVector fullbox_mid = vars.full_box(it->parameter_box.mid(), box);
-		IntervalVector param_gradient = vars.var_box(constraint.function_->gradient(fullbox_mid));
-		for(int i = 0; i < vars.nb_var; ++i) {
-			constraint.function_->diff().jacobian(fullbox, full_hessian, bitset, vars.var(i));
-		}
-		for(int i = 0; i < vars.nb_var; ++i) {
-			param_hessian.set_row(i, vars.var_box(full_hessian.row(i)));
-		}
-		h = it->parameter_box - it->parameter_box.mid();
-		try {
-			precond(param_hessian, param_gradient);
-		} catch(...) {
-			//ibex_warning("Precond failed in newton_filter");
-		}
-		gauss_seidel(param_hessian, -param_gradient, h);
-		it->parameter_box = h + it->parameter_box.mid();
+int monotonicity_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box) {
+	auto& list = cache.parameter_caches_;
+	ParameterPavingEvaluator evaluator(*constraint.function_, constraint.variable_count_, &cache.ancestor_bounds_);
+	evaluator.set_box(box);
+	const std::vector<char> monotonic = monotonic_rows(constraint, cache, evaluator);
+	return filter_rows(list, [&](int i, int slot) {
+		return monotonic[i] ? removed_by_monotonicity : kept_row;
+	}).monotonicity;
+}
 
+int evaluation_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box) {
+	auto& list = cache.parameter_caches_;
+	ParameterPavingEvaluator evaluator(*constraint.function_, constraint.variable_count_, &cache.ancestor_bounds_);
+	evaluator.set_box(box);
+	std::vector<char> satisfied;
+	evaluator.mark_satisfied(list, satisfied);
+	return filter_rows(list, [&](int i, int slot) {
+		return satisfied[i] ? removed_by_evaluation : kept_row;
+	}).evaluation;
+}
 
+int newton_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box) {
+	auto& list = cache.parameter_caches_;
+	PavingNewton newton(constraint, cache, box, list);
+	return filter_rows(list, [&](int i, int slot) {
+		return newton.keep(list, i, slot) ? kept_row : removed_by_newton;
+	}).newton;
+}
 
-		//std::cout << "box=" << box << std::endl;
-        //fullbox.put(constraint.variable_count_, it->parameter_box);
-		//std::cout << fullbox.size() << std::endl;
-		//std::cout << vars << std::endl;
+namespace {
+// Local maximizers found by blankenship, with their values
+struct Maximizer {
+	Vector point;
+	double value;
+};
 
-		//std::cout << constraint.function_->diff() << std::endl;
-        //bool has_contracted = newton(constraint.function_->diff(), vars, fullbox);
-        if(h.is_empty()) {
-            it = list.erase(it);
-        } else {
-            it++;
-        }
-    }
+void add_maximizer(std::vector<Maximizer>& maximizers, const Vector& point, double value, double tolerance) {
+	for (Maximizer& maximizer : maximizers) {
+		Vector gap = maximizer.point - point;
+		double distance = 0;
+		for (int k = 0; k < gap.size(); ++k) {
+			distance = std::max(distance, std::fabs(gap[k]));
+		}
+		if (distance <= tolerance) {
+			if (value > maximizer.value) {
+				maximizer = Maximizer { point, value };
+			}
+			return;
+		}
+	}
+	maximizers.push_back(Maximizer { point, value });
+}
 }
 
 void blankenship(const IntervalVector& box, const SIPSystem& sys, BxpNodeData* node_data) {
-	//std::cout << "xlin(blankenship)=" << box << std::endl;
-	//BxpNodeData node_data_copy = BxpNodeData(*sys.node_data_);
 	BxpNodeData node_data_copy = BxpNodeData(*node_data);
+	const Vector x = box.mid();
 	for(int cst_index = 0; cst_index < sys.sic_constraints_.size(); ++cst_index) {
 		const auto& sic = sys.sic_constraints_[cst_index];
 		auto& cache = node_data_copy.sic_constraints_caches[cst_index];
-		//cache.parameter_caches_.clear();
-		//cache.parameter_caches_.emplace_back(ParameterEvaluationsCache(cache.initial_box_));
-		simplify_paving(sys.sic_constraints_[cst_index], cache, box, true);
-	}
-	const int MAX_ITERATIONS = 4;
-	for(int i = 0; i < MAX_ITERATIONS; ++i) {
-		for(int cst_index = 0; cst_index < sys.sic_constraints_.size(); ++cst_index) {
-			const auto& sic = sys.sic_constraints_[cst_index];
-			auto& cache = node_data_copy.sic_constraints_caches[cst_index];
-			bisect_paving(cache);
-			
-			//monotonicity_filter(sys.sic_constraints_[cst_index], cache, box);
-			//newton_filter(sys.sic_constraints_[cst_index], cache, box);
-
-			simplify_paving(sys.sic_constraints_[cst_index], cache, box, true);
-
-			//cache.update_cache(*sys.sic_constraints_[cst_index].function_, box, true);
-			//monotonicity_filter(sys.sic_constraints_[cst_index], cache, box);
-    		//evaluation_filter(sys.sic_constraints_[cst_index], cache, box);
-        	//newton_filter(sys.sic_constraints_[cst_index], cache, box);
-		}
-	}
-	//std::cout << "NEW ITER" << std::endl << std::endl;
-	for(int cst_index = 0; cst_index < sys.sic_constraints_.size(); ++cst_index) {
-		const auto& sic = sys.sic_constraints_[cst_index];
-		auto& cache = node_data_copy.sic_constraints_caches[cst_index];
-		const int max_blankenship_list_size = 2 * sic.variable_count_;
-		//auto& blankenship_list = sys.node_data_->sic_constraints_caches[cst_index].best_blankenship_points_;
 		auto& blankenship_list = node_data->sic_constraints_caches[cst_index].best_blankenship_points_;
-		//std::cout << cache.parameter_caches_.size() << std::endl;
-		//blankenship_list.clear();
-		for(const auto& param_box : cache.parameter_caches_) {
-			if(std::find(blankenship_list.begin(), blankenship_list.end(), param_box.parameter_box.mid()) == blankenship_list.end()) {
-				//std::cout << "blankenship=" << param_box.parameter_box << std::endl;
-				blankenship_list.emplace_back(param_box.parameter_box.mid());
-				//blankenship_list.emplace_back(param_box.parameter_box.mid());
+		const int max_blankenship_list_size = 2 * sic.variable_count_;
+		const int max_starts = std::max(4, 2 * sic.parameter_count_);
+		const Vector sic_x = x.subvector(0, sic.variable_count_ - 1);
+		ParameterPointPool* pool = sys.parameter_point_pool;
+		ParameterAscent ascent(sic, cache.initial_box_);
+		const double tolerance = 1e-6 * std::max(1.0, cache.initial_box_.max_diam());
+		std::vector<Maximizer> maximizers;
+		double best_value = NEG_INFINITY;
+		auto climb = [&](const Vector& start) {
+			double value;
+			const Vector point = ascent.maximize(sic_x, start, value);
+			if (value > NEG_INFINITY) {
+				add_maximizer(maximizers, point, value, tolerance);
+				best_value = std::max(best_value, value);
+			}
+		};
+
+		// Multistart ascent from the previous maximizers, the points found near x
+		// in other nodes and the worst boxes of the paving
+		for (const Vector& point : blankenship_list) {
+			climb(point);
+		}
+		if (pool != nullptr) {
+			for (const Vector& point : pool->select(cst_index, IntervalVector(sic_x), pool->nb_seeds)) {
+				climb(point);
+			}
+		}
+		simplify_paving(sic, cache, box, true);
+		ParameterPaving& paving = cache.parameter_caches_;
+		paving.sort_by_evaluation_ub();
+		for (int i = 0; i < std::min(paving.size(), max_starts); ++i) {
+			climb(paving.parameter_mid(i));
+		}
+
+		// Certification: branch and bound over y, from the worst boxes. A box that
+		// may still exceed the best maximizer is bisected, and is a new starting
+		// point if it contains none. The other boxes are left as they are.
+		ParameterPavingEvaluator evaluator(*sic.function_, sic.variable_count_);
+		evaluator.set_box(box);
+		const ParameterBisector bisector(sic.variable_count_);
+		IntervalVector full_gradient(sic.function_->nb_var());
+		std::priority_queue<std::pair<double, int>> active;
+		for (int i = 0; i < paving.size(); ++i) {
+			if (paving.evaluation(i).ub() > best_value) {
+				active.emplace(paving.evaluation(i).ub(), i);
+			}
+		}
+		// At most as many bisections as a bisection of the whole paving
+		const int max_bisections = paving.size();
+		int nb_bisections = 0;
+		int nb_restarts = 0;
+		while (!active.empty() && nb_bisections < max_bisections && nb_restarts < max_starts) {
+			const int i = active.top().second;
+			active.pop();
+			if (paving.evaluation(i).ub() <= best_value) {
+				break;
+			}
+			const IntervalVector parameter_box = paving.parameter_box(i);
+			bool explored = false;
+			for (const Maximizer& maximizer : maximizers) {
+				explored = explored || parameter_box.contains(maximizer.point);
+			}
+			if (!explored) {
+				climb(paving.parameter_mid(i));
+				++nb_restarts;
+			}
+			const int first_new_row = paving.size();
+			if (!bisector.bisect(paving, i)) {
+				continue;
+			}
+			++nb_bisections;
+			auto evaluate = [&](int j) {
+				paving.set_evaluation(j, evaluator.eval(paving, j, full_gradient));
+				paving.set_full_gradient(j, full_gradient);
+				if (paving.evaluation(j).ub() > best_value) {
+					active.emplace(paving.evaluation(j).ub(), j);
+				}
+			};
+			evaluate(i);
+			for (int j = first_new_row; j < paving.size(); ++j) {
+				evaluate(j);
+			}
+		}
+
+		// The best maximizers are appended last, the list drops its first points
+		std::sort(maximizers.begin(), maximizers.end(), [](const Maximizer& a, const Maximizer& b) {
+			return a.value < b.value;
+		});
+		for (const Maximizer& maximizer : maximizers) {
+			if (pool != nullptr) {
+				pool->add(cst_index, maximizer.point, maximizer.value, IntervalVector(sic_x));
+			}
+			auto it = std::find(blankenship_list.begin(), blankenship_list.end(), maximizer.point);
+			if (it != blankenship_list.end()) {
+				blankenship_list.erase(it);
 			}
+			blankenship_list.emplace_back(maximizer.point);
 		}
 		while(blankenship_list.size() > max_blankenship_list_size) {
 			blankenship_list.pop_front();
@@ -12,6 +12,7 @@
 #ifndef __SIP_IBEX_IBEX_SIC_PAVING_H__
 #define __SIP_IBEX_IBEX_SIC_PAVING_H__
 
+#include "ibex_ParameterBisector.h"
 #include "ibex_SIConstraint.h"
 #include "ibex_SIConstraintCache.h"
 #include "ibex_SIPSystem.h"
@@ -29,12 +30,51 @@ private:
     const Function& f_;
 }*/
 
-void bisect_paving(SIConstraintCache& cache);
-bool is_feasible_with_paving(const SIConstraint& constraint, const SIConstraintCache& cache, const IntervalVector& box);
-void simplify_paving(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box, bool with_newton=false);
-void monotonicity_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box);
-void evaluation_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box);
-void newton_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box);
+void bisect_paving(SIConstraintCache& cache, const ParameterBisector& bisector);
+bool is_feasible_with_paving(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box);
+/**
+ * \brief Number of parameter boxes removed by each filter of simplify_paving.
+ */
+struct PavingFilterStats {
+	int monotonicity = 0;
+	int evaluation = 0;
+	int newton = 0;
+
+	PavingFilterStats& operator+=(const PavingFilterStats& other) {
+		monotonicity += other.monotonicity;
+		evaluation += other.evaluation;
+		newton += other.newton;
+		return *this;
+	}
+};
+
+/**
+ * \brief Update the cache on box and apply the monotonicity, evaluation and (if with_newton)
+ * Newton filters.
+ *
+ * The rows removed by the monotonicity filter are not evaluated, the other
+ * ones are evaluated in batches (see ParameterPavingEvaluator::mark_satisfied).
+ *
+ * If stats is not null, the number of boxes removed by each filter is added to it.
+ */
+void simplify_paving(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box, bool with_newton=false,
+		PavingFilterStats* stats=nullptr);
+
+// Each filter returns the number of boxes removed. The filters are applied
+// on the ancestors of the rows (see ParameterPaving) before the rows
+// themselves, and remove all the rows below an ancestor they remove.
+int monotonicity_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box);
+int evaluation_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box);
+int newton_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box);
+/**
+ * \brief Update the Blankenship points of node_data with the worst parameters at the point box.
+ *
+ * For each SIC, local ascents in the parameters (see ParameterAscent) start from
+ * the previous Blankenship points and the worst boxes of the paving. A
+ * best-first branch and bound over the parameters then only bisects the boxes
+ * that may exceed the best value found, and the ascent is restarted from those
+ * which contain no maximizer.
+ */
 void blankenship(const IntervalVector& box, const SIPSystem& sys, BxpNodeData* node_data);
 }
 
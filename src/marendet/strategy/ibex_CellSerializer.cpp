@@ -0,0 +1,69 @@
+/* ============================================================================
+ * I B E X - ibex_CellSerializer.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_CellSerializer.h"
+
+#include "ibex_SIPSystem.h"
+
+#include "ibex_Bxp.h"
+#include "ibex_Exception.h"
+
+namespace ibex {
+
+CellSerializer::Snapshot::Snapshot(const Cell& cell) :
+		box(cell.box), bisected_var(cell.bisected_var), has_node_data(false), init_box(1) {
+	const BxpNodeData* node_data = (const BxpNodeData*) cell.prop[BxpNodeData::id];
+	if (node_data != nullptr) {
+		has_node_data = true;
+		init_box = node_data->init_box;
+		caches = node_data->sic_constraints_caches;
+	}
+}
+
+void CellSerializer::serialize(BinaryWriter& writer, const Snapshot& snapshot) {
+	writer.write_interval_vector(snapshot.box);
+	writer.write_long(snapshot.bisected_var);
+	writer.write_long(snapshot.has_node_data);
+	if (snapshot.has_node_data) {
+		BxpNodeData::serialize(writer, snapshot.init_box, snapshot.caches);
+	}
+}
+
+void CellSerializer::serialize(BinaryWriter& writer, const Cell& cell) {
+	writer.write_interval_vector(cell.box);
+	writer.write_long(cell.bisected_var);
+	const BxpNodeData* node_data = (const BxpNodeData*) cell.prop[BxpNodeData::id];
+	writer.write_long(node_data != nullptr);
+	if (node_data != nullptr) {
+		node_data->serialize(writer);
+	}
+}
+
+Cell* CellSerializer::deserialize(BinaryReader& reader, const Cell& prototype) {
+	IntervalVector box = reader.read_interval_vector();
+	if (box.size() != prototype.box.size()) {
+		ibex_error("CellSerializer: the serialized cell has another dimension");
+	}
+	Cell* cell = new Cell(prototype);
+	cell->box = box;
+	cell->bisected_var = reader.read_long();
+	if (reader.read_long()) {
+		BxpNodeData* node_data = (BxpNodeData*) cell->prop[BxpNodeData::id];
+		if (node_data == nullptr) {
+			ibex_error("CellSerializer: the prototype cell has no node data");
+		}
+		node_data->deserialize(reader);
+	}
+	// The other properties follow the new box
+	cell->prop.update(BoxEvent(cell->box, BoxEvent::CHANGE));
+	return cell;
+}
+
+} // end namespace ibex
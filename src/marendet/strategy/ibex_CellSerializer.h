@@ -0,0 +1,65 @@
+/* ============================================================================
+ * I B E X - ibex_CellSerializer.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_CELLSERIALIZER_H__
+#define __SIP_IBEX_CELLSERIALIZER_H__
+
+#include "ibex_BinarySerializer.h"
+#include "ibex_SIConstraintCache.h"
+
+#include "ibex_Cell.h"
+#include "ibex_IntervalVector.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \brief Binary encoding of the cells of a search.
+ *
+ * A cell is written with its box and its node data (see BxpNodeData::serialize).
+ * The other properties of the cell are not written: they are computed from
+ * the box. A cell is read as a copy of a prototype cell, typically the root
+ * of the search with all the properties of the search, in which the box and
+ * the node data are replaced.
+ */
+class CellSerializer {
+public:
+	/**
+	 * \brief What serialize writes of a cell, copied to be written later.
+	 *
+	 * Taking a snapshot is cheap: the parameter pavings are shared with the
+	 * cell (copy-on-write) and the snapshot can be serialized by another
+	 * thread while the search goes on.
+	 */
+	struct Snapshot {
+		explicit Snapshot(const Cell& cell);
+
+		IntervalVector box;
+		long bisected_var;
+		bool has_node_data;
+		IntervalVector init_box;
+		std::vector<SIConstraintCache> caches;
+	};
+
+	static void serialize(BinaryWriter& writer, const Cell& cell);
+	static void serialize(BinaryWriter& writer, const Snapshot& snapshot);
+
+	/**
+	 * \brief Read a cell written by serialize.
+	 *
+	 * The cell is allocated with new.
+	 */
+	static Cell* deserialize(BinaryReader& reader, const Cell& prototype);
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_CELLSERIALIZER_H__
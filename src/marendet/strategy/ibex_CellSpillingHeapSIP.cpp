@@ -0,0 +1,173 @@
+/* ============================================================================
+ * I B E X - ibex_CellSpillingHeapSIP.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_CellSpillingHeapSIP.h"
+
+#include "ibex_BinarySerializer.h"
+#include "ibex_CellSerializer.h"
+
+#include "ibex_Bxp.h"
+
+using namespace std;
+
+namespace ibex {
+
+const double CellSpillingHeapSIP::default_spill_ratio = 0.75;
+
+CellSpillingHeapSIP::CellSpillingHeapSIP(const SIPSystem& sys, size_t memory_budget, const string& directory) :
+		memory_budget(memory_budget), spill_ratio(default_spill_ratio), sys(sys), file_(directory), memory_(0),
+		prototype_(nullptr), nb_spilled_(0), nb_loaded_(0) {
+}
+
+CellSpillingHeapSIP::~CellSpillingHeapSIP() {
+	flush();
+}
+
+void CellSpillingHeapSIP::add_property(IntervalVector& init_root, BoxProperties& map) {
+	// The lower bound of the objective requires no data
+}
+
+double CellSpillingHeapSIP::cost(const Cell& cell) const {
+	return cell.box[sys.ext_nb_var - 1].lb();
+}
+
+size_t CellSpillingHeapSIP::footprint(const Cell& cell) {
+	size_t bytes = sizeof(Cell) + cell.box.size() * sizeof(Interval);
+	const BxpNodeData* node_data = (const BxpNodeData*) cell.prop[BxpNodeData::id];
+	if (node_data != nullptr) {
+		for (const SIConstraintCache& cache : node_data->sic_constraints_caches) {
+			bytes += sizeof(SIConstraintCache) + cache.parameter_caches_.memory_footprint();
+			for (const Vector& point : cache.best_blankenship_points_) {
+				bytes += point.size() * sizeof(double);
+			}
+		}
+	}
+	return bytes;
+}
+
+void CellSpillingHeapSIP::flush() {
+	for (auto& entry : in_memory_) {
+		delete entry.second.first;
+	}
+	in_memory_.clear();
+	on_disk_.clear();
+	file_.clear();
+	memory_ = 0;
+	// The next search may have other properties
+	delete prototype_;
+	prototype_ = nullptr;
+}
+
+unsigned int CellSpillingHeapSIP::size() const {
+	return in_memory_.size() + on_disk_.size();
+}
+
+bool CellSpillingHeapSIP::empty() const {
+	return in_memory_.empty() && on_disk_.empty();
+}
+
+void CellSpillingHeapSIP::push(Cell* cell) {
+	if (prototype_ == nullptr) {
+		prototype_ = new Cell(*cell);
+	}
+	const size_t bytes = footprint(*cell);
+	in_memory_.emplace(cost(*cell), make_pair(cell, bytes));
+	memory_ += bytes;
+	if (memory_ > memory_budget) {
+		spill();
+	}
+}
+
+void CellSpillingHeapSIP::spill() const {
+	const size_t target = spill_ratio * memory_budget;
+	// The best cell stays in memory
+	while (memory_ > target && in_memory_.size() > 1) {
+		auto worst = std::prev(in_memory_.end());
+		Cell* cell = worst->second.first;
+		BinaryWriter writer;
+		CellSerializer::serialize(writer, *cell);
+		on_disk_.emplace(worst->first, file_.store(writer.data()));
+		memory_ -= worst->second.second;
+		in_memory_.erase(worst);
+		delete cell;
+		++nb_spilled_;
+	}
+}
+
+void CellSpillingHeapSIP::load_best() const {
+	if (on_disk_.empty() || (!in_memory_.empty() && in_memory_.begin()->first <= on_disk_.begin()->first)) {
+		return;
+	}
+	auto best = on_disk_.begin();
+	const string data = file_.load(best->second);
+	BinaryReader reader(data);
+	Cell* cell = CellSerializer::deserialize(reader, *prototype_);
+	file_.release(best->second);
+	// It is the best cell of the buffer
+	const double lb = best->first;
+	on_disk_.erase(best);
+	const size_t bytes = footprint(*cell);
+	in_memory_.emplace_hint(in_memory_.begin(), lb, make_pair(cell, bytes));
+	memory_ += bytes;
+	++nb_loaded_;
+	if (memory_ > memory_budget) {
+		spill();
+	}
+}
+
+Cell* CellSpillingHeapSIP::pop() {
+	if (empty()) {
+		return nullptr;
+	}
+	load_best();
+	auto best = in_memory_.begin();
+	Cell* cell = best->second.first;
+	memory_ -= best->second.second;
+	in_memory_.erase(best);
+	return cell;
+}
+
+Cell* CellSpillingHeapSIP::top() const {
+	if (empty()) {
+		return nullptr;
+	}
+	load_best();
+	return in_memory_.begin()->second.first;
+}
+
+double CellSpillingHeapSIP::minimum() const {
+	double minimum = POS_INFINITY;
+	if (!in_memory_.empty()) {
+		minimum = in_memory_.begin()->first;
+	}
+	if (!on_disk_.empty()) {
+		minimum = std::min(minimum, on_disk_.begin()->first);
+	}
+	return minimum;
+}
+
+void CellSpillingHeapSIP::contract(double loup) {
+	for (auto it = in_memory_.upper_bound(loup); it != in_memory_.end(); it = in_memory_.erase(it)) {
+		memory_ -= it->second.second;
+		delete it->second.first;
+	}
+	for (auto it = on_disk_.upper_bound(loup); it != on_disk_.end(); it = on_disk_.erase(it)) {
+		file_.release(it->second);
+	}
+}
+
+std::ostream& CellSpillingHeapSIP::print(std::ostream& os) const {
+	os << "==============================================================================\n";
+	os << " in memory: " << in_memory_.size() << " cells, " << memory_ << " bytes" << std::endl;
+	os << " on disk: " << on_disk_.size() << " cells, " << file_.used() << " bytes" << std::endl;
+	return os;
+}
+
+} // end namespace ibex
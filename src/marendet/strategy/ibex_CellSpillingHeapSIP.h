@@ -0,0 +1,160 @@
+/* ============================================================================
+ * I B E X - ibex_CellSpillingHeapSIP.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_CELLSPILLINGHEAPSIP_H__
+#define __SIP_IBEX_CELLSPILLINGHEAPSIP_H__
+
+#include "ibex_SIPSystem.h"
+#include "ibex_SpillFile.h"
+
+#include "ibex_Cell.h"
+#include "ibex_CellBufferOptim.h"
+#include "ibex_IntervalVector.h"
+
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Best-first buffer with a bounded memory footprint
+ *
+ * The cells are ordered by the lower bound of the objective, like the first
+ * heap of CellDoubleHeapSIP. When the cells in memory exceed the budget, the
+ * least promising ones (largest lower bounds) are serialized (see
+ * CellSerializer) in a memory-mapped temporary file, until they use
+ * \a spill_ratio times the budget. A cell on disk is read back when it becomes
+ * the best cell of the buffer.
+ *
+ * The lower bounds of the cells on disk are kept in memory: minimum() and
+ * contract() are exact and do not read the file. The node data of a cell
+ * read back is restored, its other properties are rebuilt from the box.
+ */
+class CellSpillingHeapSIP: public CellBufferOptim {
+
+public:
+
+	/**
+	 * \brief Default fraction of the budget used by the cells in memory after a spill: 0.75.
+	 */
+	static const double default_spill_ratio;
+
+	/**
+	 * \brief Create the buffer.
+	 *
+	 * \param sys           - the system to optimize
+	 * \param memory_budget - bytes of the cells kept in memory (estimated, see footprint)
+	 * \param directory     - directory of the spill file, see SpillFile
+	 */
+	CellSpillingHeapSIP(const SIPSystem& sys, std::size_t memory_budget, const std::string& directory = "");
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~CellSpillingHeapSIP();
+
+	/**
+	 * \brief Add backtrackable data required by this buffer.
+	 */
+	virtual void add_property(IntervalVector& init_box, BoxProperties& map);
+
+	/**
+	 * \brief Flush the buffer.
+	 *
+	 * All the remaining cells will be *deleted*
+	 */
+	void flush();
+
+	/** \brief Return the number of cells, in memory and on disk. */
+	unsigned int size() const;
+
+	/** \brief Return true if the buffer is empty. */
+	bool empty() const;
+
+	/** \brief Push a new cell in the buffer. */
+	void push(Cell* cell);
+
+	/** \brief Pop the cell with the smallest lower bound and return it. */
+	Cell* pop();
+
+	/** \brief Return the next cell (but does not pop it), after reading it from disk if needed. */
+	Cell* top() const;
+
+	std::ostream& print(std::ostream& os) const;
+
+	/**
+	 * \brief Return the minimum lower bound of the cells, in memory and on disk.
+	 */
+	virtual double minimum() const;
+
+	/**
+	 * \brief Contract the buffer
+	 *
+	 * Removes (and deletes) all the cells with a lower bound greater
+	 * than \a loup, in memory and on disk.
+	 */
+	virtual void contract(double loup);
+
+	/**
+	 * \brief Estimated bytes of a cell: its box and the pavings of its node data.
+	 */
+	static std::size_t footprint(const Cell& cell);
+
+	/** \brief Bytes of the cells kept in memory. */
+	std::size_t memory_budget;
+
+	/** \brief Fraction of the budget used by the cells in memory after a spill. */
+	double spill_ratio;
+
+	/** \brief Number of cells written to disk since the creation of the buffer. */
+	long nb_spilled() const;
+
+	/** \brief Number of cells read back from disk since the creation of the buffer. */
+	long nb_loaded() const;
+
+private:
+	double cost(const Cell& cell) const;
+	void spill() const;
+	void load_best() const;
+
+	const SIPSystem& sys;
+
+	/* Cells in memory with their footprint, by lower bound */
+	mutable std::multimap<double, std::pair<Cell*, std::size_t>> in_memory_;
+	/* Blocks of the cells on disk, by lower bound */
+	mutable std::multimap<double, SpillFile::Extent> on_disk_;
+	mutable SpillFile file_;
+	mutable std::size_t memory_;
+
+	/* Copy of the first cell pushed: the cells read back are copies of it */
+	Cell* prototype_;
+
+	mutable long nb_spilled_;
+	mutable long nb_loaded_;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline long CellSpillingHeapSIP::nb_spilled() const {
+	return nb_spilled_;
+}
+
+inline long CellSpillingHeapSIP::nb_loaded() const {
+	return nb_loaded_;
+}
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_CELLSPILLINGHEAPSIP_H__
@@ -0,0 +1,274 @@
+/* ============================================================================
+ * I B E X - ibex_CellWorkStealingHeap.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_CellWorkStealingHeap.h"
+
+#include "ibex_Exception.h"
+#include "ibex_ExtendedSystem.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+// Lock-free reads of minimum() retried before locking all the heaps
+const int max_minimum_attempts = 8;
+}
+
+const int CellWorkStealingHeap::default_rebalance_period = 16;
+
+thread_local int CellWorkStealingHeap::thread_index_ = 0;
+
+CellWorkStealingHeap::LocalHeap::LocalHeap(const SIPSystem& sys, int nb_threads, int crit2_pr,
+		CellCostFunc::criterion crit2) :
+		cost1(new CellCostVarLB(*(ExtendedSystem*) sys.ibex_system_, sys.ext_nb_var - 1)),
+		cost2(CellCostFunc::get_cost(*(ExtendedSystem*) sys.ibex_system_, crit2, sys.ext_nb_var - 1)),
+		heap(new DoubleHeap<Cell>(*cost1, false, *cost2, cost2->depends_on_loup, crit2_pr)),
+		in_flight(nb_threads, POS_INFINITY), heap_minimum(POS_INFINITY), minimum(POS_INFINITY), size(0) {
+}
+
+CellWorkStealingHeap::LocalHeap::~LocalHeap() {
+	heap->flush();
+	delete heap;
+	delete cost1;
+	delete cost2;
+}
+
+CellWorkStealingHeap::CellWorkStealingHeap(const SIPSystem& sys, int nb_heaps, int crit2_pr,
+		CellCostFunc::criterion crit2) :
+		rebalance_period(default_rebalance_period), origin_(nb_heaps), selected_(nb_heaps, -1),
+		nb_pops_(nb_heaps, 0), generation_(0) {
+	if (nb_heaps < 1) {
+		ibex_error("CellWorkStealingHeap: the number of heaps must be positive");
+	}
+	for (int i = 0; i < nb_heaps; ++i) {
+		heaps_.push_back(new LocalHeap(sys, nb_heaps, crit2_pr, crit2));
+		origin_[i] = -1;
+	}
+}
+
+CellWorkStealingHeap::~CellWorkStealingHeap() {
+	for (LocalHeap* local : heaps_) {
+		delete local;
+	}
+}
+
+void CellWorkStealingHeap::attach(int index) {
+	thread_index_ = index % (int) heaps_.size();
+}
+
+int CellWorkStealingHeap::thread_index() const {
+	return thread_index_ < (int) heaps_.size() ? thread_index_ : 0;
+}
+
+void CellWorkStealingHeap::add_property(IntervalVector& init_root, BoxProperties& map) {
+	// add data "pu" and "pf" (if required)
+	heaps_[0]->cost2->add_property(map);
+}
+
+void CellWorkStealingHeap::publish(LocalHeap& local) {
+	const double heap_minimum = local.heap->empty() ? POS_INFINITY : local.heap->minimum();
+	double minimum = heap_minimum;
+	for (double cost : local.in_flight) {
+		minimum = std::min(minimum, cost);
+	}
+	local.heap_minimum.store(heap_minimum);
+	local.minimum.store(minimum);
+	local.size.store(local.heap->size());
+}
+
+void CellWorkStealingHeap::flush() {
+	for (LocalHeap* local : heaps_) {
+		std::lock_guard<std::mutex> lock(local->mutex);
+		local->heap->flush();
+		fill(local->in_flight.begin(), local->in_flight.end(), POS_INFINITY);
+		publish(*local);
+	}
+	for (std::atomic<int>& origin : origin_) {
+		origin = -1;
+	}
+	fill(selected_.begin(), selected_.end(), -1);
+}
+
+unsigned int CellWorkStealingHeap::size() const {
+	unsigned int size = 0;
+	for (const LocalHeap* local : heaps_) {
+		size += local->size.load();
+	}
+	return size;
+}
+
+bool CellWorkStealingHeap::empty() const {
+	return size() == 0;
+}
+
+void CellWorkStealingHeap::push(Cell* cell) {
+	LocalHeap& local = *heaps_[thread_index()];
+	std::lock_guard<std::mutex> lock(local.mutex);
+	// we know cost1() does not require OptimData
+	local.cost2->set_optim_data(*cell);
+	local.heap->push(cell);
+	publish(local);
+}
+
+int CellWorkStealingHeap::select_heap(int thread, bool rebalance) const {
+	const int own = thread;
+	const bool own_empty = heaps_[own]->size.load() == 0;
+	if (!own_empty && !rebalance) {
+		return own;
+	}
+	// Best-first among the other heaps
+	int best = own_empty ? -1 : own;
+	double best_minimum = own_empty ? POS_INFINITY : heaps_[own]->heap_minimum.load();
+	for (int h = 0; h < (int) heaps_.size(); ++h) {
+		if (h == own || heaps_[h]->size.load() == 0) {
+			continue;
+		}
+		const double minimum = heaps_[h]->heap_minimum.load();
+		if (best < 0 || minimum < best_minimum) {
+			best = h;
+			best_minimum = minimum;
+		}
+	}
+	return best;
+}
+
+Cell* CellWorkStealingHeap::pop() {
+	const int t = thread_index();
+	release();
+	const bool rebalance = ++nb_pops_[t] % rebalance_period == 0;
+	int h = selected_[t];
+	selected_[t] = -1;
+	// The selected heap may be emptied by other threads before it is locked
+	for (int attempt = 0; attempt < (int) heaps_.size() + 1; ++attempt) {
+		if (h < 0) {
+			h = select_heap(t, rebalance);
+		}
+		if (h < 0) {
+			return nullptr;
+		}
+		LocalHeap& local = *heaps_[h];
+		std::lock_guard<std::mutex> lock(local.mutex);
+		if (!local.heap->empty()) {
+			Cell* cell = local.heap->pop();
+			local.in_flight[t] = local.cost1->cost(*cell);
+			origin_[t] = h;
+			publish(local);
+			return cell;
+		}
+		h = -1;
+	}
+	return nullptr;
+}
+
+Cell* CellWorkStealingHeap::top() const {
+	const int t = thread_index();
+	const int h = select_heap(t, (nb_pops_[t] + 1) % rebalance_period == 0);
+	selected_[t] = h;
+	if (h < 0) {
+		return nullptr;
+	}
+	LocalHeap& local = *heaps_[h];
+	std::lock_guard<std::mutex> lock(local.mutex);
+	return local.heap->empty() ? nullptr : local.heap->top();
+}
+
+void CellWorkStealingHeap::release() {
+	const int t = thread_index();
+	const int h = origin_[t].load();
+	if (h < 0) {
+		return;
+	}
+	// Readers that may have missed the children pushed meanwhile must retry
+	generation_.fetch_add(1);
+	LocalHeap& local = *heaps_[h];
+	std::lock_guard<std::mutex> lock(local.mutex);
+	local.in_flight[t] = POS_INFINITY;
+	publish(local);
+	origin_[t] = -1;
+}
+
+bool CellWorkStealingHeap::idle() const {
+	while (true) {
+		const unsigned long generation = generation_.load();
+		// Sizes first: a thread sets its origin before decreasing the size of a heap
+		for (const LocalHeap* local : heaps_) {
+			if (local->size.load() > 0) {
+				return false;
+			}
+		}
+		for (const std::atomic<int>& origin : origin_) {
+			if (origin.load() >= 0) {
+				return false;
+			}
+		}
+		if (generation_.load() == generation) {
+			return true;
+		}
+	}
+}
+
+double CellWorkStealingHeap::minimum() const {
+	for (int attempt = 0; attempt < max_minimum_attempts; ++attempt) {
+		const unsigned long generation = generation_.load();
+		double minimum = POS_INFINITY;
+		for (const LocalHeap* local : heaps_) {
+			minimum = std::min(minimum, local->minimum.load());
+		}
+		if (generation_.load() == generation) {
+			return minimum;
+		}
+	}
+	return locked_minimum();
+}
+
+double CellWorkStealingHeap::locked_minimum() const {
+	// Always lock in the same order; the other operations hold one lock at a time
+	vector<std::unique_lock<std::mutex>> locks;
+	double minimum = POS_INFINITY;
+	for (LocalHeap* local : heaps_) {
+		locks.emplace_back(local->mutex);
+		minimum = std::min(minimum, local->minimum.load());
+	}
+	return minimum;
+}
+
+void CellWorkStealingHeap::contract(double new_loup) {
+	for (LocalHeap* local : heaps_) {
+		std::lock_guard<std::mutex> lock(local->mutex);
+		// DoubleHeap::contract requires the costs of
+		// the first heap to be up-to-date.
+		if (local->cost1->depends_on_loup) {
+			local->cost1->set_loup(new_loup);
+			local->heap->heap1->sort();
+		}
+		local->cost2->set_loup(new_loup);
+		local->heap->contract(new_loup);
+		for (double& cost : local->in_flight) {
+			if (cost > new_loup) {
+				cost = POS_INFINITY;
+			}
+		}
+		publish(*local);
+	}
+}
+
+std::ostream& CellWorkStealingHeap::print(std::ostream& os) const {
+	os << "==============================================================================\n";
+	for (int h = 0; h < (int) heaps_.size(); ++h) {
+		os << " heap " << h << " size " << heaps_[h]->size.load() << " minimum "
+				<< heaps_[h]->heap_minimum.load() << std::endl;
+	}
+	return os;
+}
+
+} // end namespace ibex
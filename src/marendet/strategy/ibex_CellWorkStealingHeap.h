@@ -0,0 +1,188 @@
+/* ============================================================================
+ * I B E X - ibex_CellWorkStealingHeap.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_CELLWORKSTEALINGHEAP_H__
+#define __SIP_IBEX_CELLWORKSTEALINGHEAP_H__
+
+#include "ibex_SIPSystem.h"
+
+#include "ibex_Cell.h"
+#include "ibex_CellBufferOptim.h"
+#include "ibex_CellCostFunc.h"
+#include "ibex_DoubleHeap.h"
+#include "ibex_IntervalVector.h"
+
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Double-heap buffer shared by several search threads
+ *
+ * Each thread pushes and pops the cells of its own double heap (same
+ * criteria as CellDoubleHeapSIP), under a lock that only the threads
+ * stealing from it compete for. A thread with an empty heap steals the
+ * best cell of the other heaps. Every \a rebalance_period pops, it also
+ * takes the best cell of the other heaps if it is better than its own,
+ * so that the search stays close to best-first.
+ *
+ * A popped cell is "in flight" until the thread calls release() or pops
+ * again: minimum() includes its lower bound, so that it stays a valid
+ * lower bound of the objective while the cell is processed. The children
+ * of the cell must be pushed before it is released.
+ */
+class CellWorkStealingHeap: public CellBufferOptim {
+
+public:
+
+	/**
+	 * \brief Default number of pops between two rebalancings: 16.
+	 */
+	static const int default_rebalance_period;
+
+	/**
+	 * \brief Create the buffer.
+	 *
+	 * \param sys       - the system to optimize
+	 * \param nb_heaps  - number of heaps (one per thread)
+	 * \param crit2_pr  - probability to choose the second criterion, see CellDoubleHeapSIP
+	 * \param crit2     - second criterion in node selection
+	 */
+	CellWorkStealingHeap(const SIPSystem& sys, int nb_heaps, int crit2_pr = 50,
+			CellCostFunc::criterion crit2 = CellCostFunc::UB);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~CellWorkStealingHeap();
+
+	/**
+	 * \brief Make the calling thread use the heap number \a index.
+	 *
+	 * Threads that are not attached use the first heap.
+	 */
+	void attach(int index);
+
+	/**
+	 * \brief Add backtrackable data required by this buffer.
+	 */
+	virtual void add_property(IntervalVector& init_box, BoxProperties& map);
+
+	/**
+	 * \brief Flush the buffer.
+	 *
+	 * All the remaining cells will be *deleted*
+	 */
+	void flush();
+
+	/** \brief Return the number of cells in the heaps. */
+	unsigned int size() const;
+
+	/** \brief Return true if the heaps are empty (cells in flight are not counted). */
+	bool empty() const;
+
+	/** \brief Push a new cell in the heap of the calling thread. */
+	void push(Cell* cell);
+
+	/**
+	 * \brief Pop a cell and return it.
+	 *
+	 * The cell is taken from the heap of the calling thread, or stolen
+	 * from another heap. Return nullptr if all the heaps are empty.
+	 */
+	Cell* pop();
+
+	/**
+	 * \brief Return the next cell of the calling thread (but does not pop it).
+	 *
+	 * With several threads, another thread may pop this cell first: concurrent
+	 * users should only call pop().
+	 */
+	Cell* top() const;
+
+	/**
+	 * \brief Mark the cell popped by the calling thread as processed.
+	 */
+	void release();
+
+	/**
+	 * \brief Return true if the heaps are empty and no cell is in flight.
+	 */
+	bool idle() const;
+
+	std::ostream& print(std::ostream& os) const;
+
+	/**
+	 * \brief Return the minimum value of the heaps and of the cells in flight.
+	 *
+	 * Does not lock the heaps, unless the cells keep moving between
+	 * threads while reading them.
+	 */
+	virtual double minimum() const;
+
+	/**
+	 * \brief Contract the heaps
+	 *
+	 * Removes (and deletes) from the heaps all the cells with a cost
+	 * greater than \a loup. Cells in flight with a cost greater than
+	 * \a loup do not count in minimum() anymore.
+	 */
+	virtual void contract(double loup);
+
+	/**
+	 * \brief Number of pops between two rebalancings.
+	 */
+	int rebalance_period;
+
+private:
+	struct LocalHeap {
+		LocalHeap(const SIPSystem& sys, int nb_threads, int crit2_pr, CellCostFunc::criterion crit2);
+		~LocalHeap();
+
+		std::mutex mutex;
+		CellCostFunc* cost1;
+		CellCostFunc* cost2;
+		DoubleHeap<Cell>* heap;
+		/* Cost of the cell popped by each thread from this heap, +oo if none */
+		std::vector<double> in_flight;
+
+		/* Published under the mutex, read without it */
+		std::atomic<double> heap_minimum;
+		std::atomic<double> minimum;
+		std::atomic<unsigned int> size;
+	};
+
+	int thread_index() const;
+	int select_heap(int thread, bool rebalance) const;
+	void publish(LocalHeap& local);
+	double locked_minimum() const;
+
+	std::vector<LocalHeap*> heaps_;
+
+	/* Heap of the cell being processed by each thread, -1 if none */
+	std::vector<std::atomic<int>> origin_;
+	/* Heap chosen by the last top() of each thread, -1 if none */
+	mutable std::vector<int> selected_;
+	std::vector<int> nb_pops_;
+
+	/* Incremented each time a thread releases a cell, to validate lock-free reads */
+	std::atomic<unsigned long> generation_;
+
+	static thread_local int thread_index_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_CELLWORKSTEALINGHEAP_H__
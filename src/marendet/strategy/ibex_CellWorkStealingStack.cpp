@@ -0,0 +1,144 @@
+/* ============================================================================
+ * I B E X - ibex_CellWorkStealingStack.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_CellWorkStealingStack.h"
+
+#include "ibex_Exception.h"
+
+using namespace std;
+
+namespace ibex {
+
+thread_local int CellWorkStealingStack::thread_index_ = 0;
+
+CellWorkStealingStack::CellWorkStealingStack(int nb_stacks) {
+	if (nb_stacks < 1) {
+		ibex_error("CellWorkStealingStack: the number of stacks must be positive");
+	}
+	for (int i = 0; i < nb_stacks; ++i) {
+		stacks_.push_back(new LocalStack());
+	}
+}
+
+CellWorkStealingStack::~CellWorkStealingStack() {
+	flush();
+	for (LocalStack* local : stacks_) {
+		delete local;
+	}
+}
+
+void CellWorkStealingStack::attach(int index) {
+	thread_index_ = index % (int) stacks_.size();
+}
+
+int CellWorkStealingStack::thread_index() const {
+	return thread_index_ < (int) stacks_.size() ? thread_index_ : 0;
+}
+
+void CellWorkStealingStack::flush() {
+	for (LocalStack* local : stacks_) {
+		std::lock_guard<std::mutex> lock(local->mutex);
+		for (Cell* cell : local->cells) {
+			delete cell;
+		}
+		local->cells.clear();
+		local->size = 0;
+	}
+}
+
+unsigned int CellWorkStealingStack::size() const {
+	unsigned int size = 0;
+	for (const LocalStack* local : stacks_) {
+		size += local->size.load();
+	}
+	return size;
+}
+
+bool CellWorkStealingStack::empty() const {
+	return size() == 0;
+}
+
+void CellWorkStealingStack::push(Cell* cell) {
+	LocalStack& local = *stacks_[thread_index()];
+	std::lock_guard<std::mutex> lock(local.mutex);
+	local.cells.push_back(cell);
+	local.size = local.cells.size();
+}
+
+int CellWorkStealingStack::victim(int thread) const {
+	int largest = -1;
+	unsigned int largest_size = 0;
+	for (int s = 0; s < (int) stacks_.size(); ++s) {
+		const unsigned int size = stacks_[s]->size.load();
+		if (s != thread && size > largest_size) {
+			largest = s;
+			largest_size = size;
+		}
+	}
+	return largest;
+}
+
+Cell* CellWorkStealingStack::pop() {
+	const int t = thread_index();
+	{
+		LocalStack& local = *stacks_[t];
+		std::lock_guard<std::mutex> lock(local.mutex);
+		if (!local.cells.empty()) {
+			Cell* cell = local.cells.back();
+			local.cells.pop_back();
+			local.size = local.cells.size();
+			return cell;
+		}
+	}
+	// The victim may be emptied by its owner before it is locked
+	for (int attempt = 0; attempt < (int) stacks_.size(); ++attempt) {
+		const int s = victim(t);
+		if (s < 0) {
+			return nullptr;
+		}
+		LocalStack& local = *stacks_[s];
+		std::lock_guard<std::mutex> lock(local.mutex);
+		if (!local.cells.empty()) {
+			Cell* cell = local.cells.front();
+			local.cells.pop_front();
+			local.size = local.cells.size();
+			return cell;
+		}
+	}
+	return nullptr;
+}
+
+Cell* CellWorkStealingStack::top() const {
+	const int t = thread_index();
+	{
+		LocalStack& local = *stacks_[t];
+		std::lock_guard<std::mutex> lock(local.mutex);
+		if (!local.cells.empty()) {
+			return local.cells.back();
+		}
+	}
+	const int s = victim(t);
+	if (s < 0) {
+		return nullptr;
+	}
+	LocalStack& local = *stacks_[s];
+	std::lock_guard<std::mutex> lock(local.mutex);
+	return local.cells.empty() ? nullptr : local.cells.front();
+}
+
+std::ostream& CellWorkStealingStack::print(std::ostream& os) const {
+	os << "==============================================================================\n";
+	for (int s = 0; s < (int) stacks_.size(); ++s) {
+		os << " stack " << s << " size " << stacks_[s]->size.load() << std::endl;
+	}
+	return os;
+}
+
+} // end namespace ibex
@@ -0,0 +1,101 @@
+/* ============================================================================
+ * I B E X - ibex_CellWorkStealingStack.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_CELLWORKSTEALINGSTACK_H__
+#define __SIP_IBEX_CELLWORKSTEALINGSTACK_H__
+
+#include "ibex_Cell.h"
+#include "ibex_CellBuffer.h"
+
+#include <atomic>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \brief Stack of cells shared by several search threads
+ *
+ * Each thread explores depth-first with its own stack. A thread with an
+ * empty stack steals the *bottom* cell of the largest stack: the oldest
+ * cells are the largest boxes, so a steal moves a whole subtree.
+ */
+class CellWorkStealingStack: public CellBuffer {
+public:
+	/**
+	 * \brief Create the buffer with one stack per thread.
+	 */
+	explicit CellWorkStealingStack(int nb_stacks);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~CellWorkStealingStack();
+
+	/**
+	 * \brief Make the calling thread use the stack number \a index.
+	 *
+	 * Threads that are not attached use the first stack.
+	 */
+	void attach(int index);
+
+	/**
+	 * \brief Flush the buffer.
+	 *
+	 * All the remaining cells will be *deleted*
+	 */
+	void flush();
+
+	/** \brief Return the number of cells in the stacks. */
+	unsigned int size() const;
+
+	/** \brief Return true if all the stacks are empty. */
+	bool empty() const;
+
+	/** \brief Push a new cell on the stack of the calling thread. */
+	void push(Cell* cell);
+
+	/**
+	 * \brief Pop a cell and return it.
+	 *
+	 * Return nullptr if all the stacks are empty.
+	 */
+	Cell* pop();
+
+	/**
+	 * \brief Return the next cell of the calling thread (but does not pop it).
+	 *
+	 * With several threads, another thread may pop this cell first: concurrent
+	 * users should only call pop().
+	 */
+	Cell* top() const;
+
+	std::ostream& print(std::ostream& os) const;
+
+private:
+	struct LocalStack {
+		std::mutex mutex;
+		std::deque<Cell*> cells;
+		std::atomic<unsigned int> size { 0 };
+	};
+
+	int thread_index() const;
+	int victim(int thread) const;
+
+	std::vector<LocalStack*> stacks_;
+
+	static thread_local int thread_index_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_CELLWORKSTEALINGSTACK_H__
@@ -0,0 +1,147 @@
+/* ============================================================================
+ * I B E X - ibex_SIPCheckpoint.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_SIPCheckpoint.h"
+
+#include "ibex_Exception.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+const char* const checkpoint_magic = "IBEX-SIP-CHECKPOINT";
+}
+
+const long SIPCheckpoint::version = 1;
+
+SIPCheckpoint::SIPCheckpoint() :
+		ext_nb_var(0), loup(POS_INFINITY), loup_point(1), initial_loup(POS_INFINITY), uplo(NEG_INFINITY),
+		uplo_epsboxes(POS_INFINITY), nb_cells(0), iter(0), time(0), nb_open_cells(0) {
+}
+
+void SIPCheckpoint::serialize(BinaryWriter& writer) const {
+	writer.write_string(checkpoint_magic);
+	writer.write_long(version);
+	writer.write_long(ext_nb_var);
+	writer.write_double(loup);
+	writer.write_interval_vector(loup_point);
+	writer.write_double(initial_loup);
+	writer.write_double(uplo);
+	writer.write_double(uplo_epsboxes);
+	writer.write_long(nb_cells);
+	writer.write_long(iter);
+	writer.write_double(time);
+	writer.write_long(nb_open_cells);
+}
+
+void SIPCheckpoint::deserialize(BinaryReader& reader) {
+	if (reader.read_string() != checkpoint_magic) {
+		ibex_error("SIPCheckpoint: not a checkpoint file");
+	}
+	if (reader.read_long() != version) {
+		ibex_error("SIPCheckpoint: checkpoint written by another version");
+	}
+	ext_nb_var = reader.read_long();
+	loup = reader.read_double();
+	loup_point = reader.read_interval_vector();
+	initial_loup = reader.read_double();
+	uplo = reader.read_double();
+	uplo_epsboxes = reader.read_double();
+	nb_cells = reader.read_long();
+	iter = reader.read_long();
+	time = reader.read_double();
+	nb_open_cells = reader.read_long();
+}
+
+string SIPCheckpoint::read_file(const string& filename) {
+	ifstream file(filename, ios::binary);
+	if (!file) {
+		ibex_error(("SIPCheckpoint: cannot read " + filename).c_str());
+	}
+	ostringstream content;
+	content << file.rdbuf();
+	return content.str();
+}
+
+AsyncCheckpointWriter::AsyncCheckpointWriter(const string& filename) :
+		filename(filename), has_pending_(false), writing_(false), stop_(false),
+		thread_(&AsyncCheckpointWriter::run, this) {
+}
+
+AsyncCheckpointWriter::~AsyncCheckpointWriter() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	cond_.notify_all();
+	thread_.join();
+}
+
+void AsyncCheckpointWriter::submit(std::function<string()> serialize) {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		pending_ = std::move(serialize);
+		has_pending_ = true;
+	}
+	cond_.notify_all();
+}
+
+void AsyncCheckpointWriter::flush() {
+	std::unique_lock<std::mutex> lock(mutex_);
+	cond_.wait(lock, [this]() {
+		return !has_pending_ && !writing_;
+	});
+}
+
+void AsyncCheckpointWriter::run() {
+	std::unique_lock<std::mutex> lock(mutex_);
+	while (true) {
+		cond_.wait(lock, [this]() {
+			return stop_ || has_pending_;
+		});
+		// The pending checkpoint is written before stopping
+		if (!has_pending_) {
+			return;
+		}
+		std::function<string()> serialize = std::move(pending_);
+		pending_ = nullptr;
+		has_pending_ = false;
+		writing_ = true;
+		lock.unlock();
+		write_file(serialize());
+		// The snapshots share pavings with the search: released as soon as possible
+		serialize = nullptr;
+		lock.lock();
+		writing_ = false;
+		cond_.notify_all();
+	}
+}
+
+void AsyncCheckpointWriter::write_file(const string& data) {
+	const string tmp_filename = filename + ".tmp";
+	{
+		ofstream file(tmp_filename, ios::binary | ios::trunc);
+		file.write(data.data(), data.size());
+		if (!file) {
+			ibex_warning(("cannot write the checkpoint " + tmp_filename).c_str());
+			return;
+		}
+	}
+	if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+		ibex_warning(("cannot rename the checkpoint " + tmp_filename + " to " + filename).c_str());
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,108 @@
+/* ============================================================================
+ * I B E X - ibex_SIPCheckpoint.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_SIPCHECKPOINT_H__
+#define __SIP_IBEX_SIPCHECKPOINT_H__
+
+#include "ibex_BinarySerializer.h"
+
+#include "ibex_IntervalVector.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ibex {
+
+/**
+ * \brief Bounds and counters of a SIPOptimizer search, at the head of a checkpoint.
+ *
+ * A checkpoint file is this header followed by the nb_open_cells open cells
+ * of the search (see CellSerializer).
+ */
+class SIPCheckpoint {
+public:
+	/** \brief Version of the format, checked when a checkpoint is read. */
+	static const long version;
+
+	SIPCheckpoint();
+
+	void serialize(BinaryWriter& writer) const;
+
+	/**
+	 * \brief Read the header written by serialize.
+	 *
+	 * Raise an ibex error if the data is not a checkpoint of this version.
+	 */
+	void deserialize(BinaryReader& reader);
+
+	/** \brief Return the content of a checkpoint file. */
+	static std::string read_file(const std::string& filename);
+
+	/** \brief Number of variables, goal variable included. */
+	long ext_nb_var;
+	double loup;
+	IntervalVector loup_point;
+	double initial_loup;
+	double uplo;
+	double uplo_epsboxes;
+	long nb_cells;
+	long iter;
+	double time;
+	long nb_open_cells;
+};
+
+/**
+ * \brief Writes checkpoints to a file, in a background thread.
+ *
+ * The search hands the writer a function returning the bytes of the
+ * checkpoint, which is called in the background thread: the search only
+ * takes snapshots of its state (see CellSerializer::Snapshot). A checkpoint
+ * submitted while the previous one is being written replaces the pending one,
+ * if any. Files are written under a temporary name,
+ * then renamed: a crash during a write keeps the previous checkpoint.
+ */
+class AsyncCheckpointWriter {
+public:
+	AsyncCheckpointWriter(const std::string& filename);
+
+	/**
+	 * \brief Delete *this, after the pending checkpoint is written.
+	 */
+	~AsyncCheckpointWriter();
+
+	/**
+	 * \brief Write the checkpoint returned by \a serialize, called in the background thread.
+	 */
+	void submit(std::function<std::string()> serialize);
+
+	/** \brief Wait until the checkpoints submitted are written. */
+	void flush();
+
+	const std::string filename;
+
+private:
+	void run();
+	void write_file(const std::string& data);
+
+	std::mutex mutex_;
+	std::condition_variable cond_;
+	std::function<std::string()> pending_;
+	bool has_pending_;
+	bool writing_;
+	bool stop_;
+	std::thread thread_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_SIPCHECKPOINT_H__
@@ -0,0 +1,98 @@
+/* ============================================================================
+ * I B E X - ibex_SIPIncumbent.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_SIPINCUMBENT_H__
+#define __SIP_IBEX_SIPINCUMBENT_H__
+
+#include "ibex_Interval.h"
+#include "ibex_IntervalVector.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace ibex {
+
+/**
+ * \brief Best feasible point shared by the search threads.
+ *
+ * The loup is an atomic value that only decreases: reading it and
+ * lowering it never take a lock. The loup point is only needed when
+ * the search ends, it is protected by a mutex.
+ */
+class SIPIncumbent {
+public:
+	SIPIncumbent();
+
+	/** \brief Reset the loup (and the point returned if no better one is found). */
+	void reset(double loup, const IntervalVector& point);
+
+	/** \brief Current loup. */
+	double loup() const;
+
+	/** \brief Point of the current loup. */
+	IntervalVector point() const;
+
+	/**
+	 * \brief Lower the loup to \a value, if it is smaller.
+	 *
+	 * Return true if \a value is the new loup.
+	 */
+	bool improve(double value, const IntervalVector& point);
+
+private:
+	std::atomic<double> loup_;
+
+	mutable std::mutex point_mutex_;
+	/* Loup value of point_, lags behind loup_ while a thread is storing its point */
+	double point_loup_;
+	IntervalVector point_;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline SIPIncumbent::SIPIncumbent() :
+		loup_(POS_INFINITY), point_loup_(POS_INFINITY), point_(1) {
+}
+
+inline void SIPIncumbent::reset(double loup, const IntervalVector& point) {
+	std::lock_guard<std::mutex> lock(point_mutex_);
+	loup_.store(loup);
+	point_loup_ = loup;
+	point_ = point;
+}
+
+inline double SIPIncumbent::loup() const {
+	return loup_.load(std::memory_order_acquire);
+}
+
+inline IntervalVector SIPIncumbent::point() const {
+	std::lock_guard<std::mutex> lock(point_mutex_);
+	return point_;
+}
+
+inline bool SIPIncumbent::improve(double value, const IntervalVector& point) {
+	double current = loup_.load(std::memory_order_acquire);
+	while (value < current) {
+		if (loup_.compare_exchange_weak(current, value, std::memory_order_acq_rel)) {
+			std::lock_guard<std::mutex> lock(point_mutex_);
+			// Another thread may have stored a better point in the meantime
+			if (value < point_loup_) {
+				point_loup_ = value;
+				point_ = point;
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_SIPINCUMBENT_H__
@@ -11,8 +11,11 @@
  
 #include "ibex_SIPOptimizer.h"
 
+#include "ibex_CellSerializer.h"
+#include "ibex_CellSpillingHeapSIP.h"
 #include "ibex_Ctc.h"
 #include "ibex_LoupFinderSIP.h"
+#include "ibex_ParameterPointPool.h"
 #include "ibex_SIPSystem.h"
 #include "ibex_utils.h"
 
@@ -27,10 +30,14 @@
 #include "ibex_Vector.h"
 
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
+#include <memory>
 #include <utility>
 #include <cassert>
+#include <functional>
+#include <thread>
 
 using namespace std;
 
@@ -41,26 +48,112 @@ const double SIPOptimizer::default_abs_eps_f = 1e-3;
 const double SIPOptimizer::default_lf_loop_ratio = 0.01;
 const double SIPOptimizer::default_eps_x = 0;
 
+SIPOptimizer::Worker::Worker(Ctc& ctc, Bsc& bisector, LoupFinder& loup_finder, LoupFinder& loup_finder2) :
+		ctc(ctc), bisector(bisector), loup_finder(loup_finder), loup_finder2(loup_finder2),
+		loup(POS_INFINITY), loup_point(1), loup_changed(false) {
+}
+
 SIPOptimizer::SIPOptimizer(int n, Ctc& ctc, Bsc& bisector, LoupFinder& loup_finder, LoupFinder& loup_finder2,
 		CellBufferOptim& buffer, int goal_var,
 		double eps_x,
 		double rel_eps_f,
 		double abs_eps_f) :
-		n(n), goal_var(goal_var), ctc_(ctc), bisector_(bisector), loup_finder_(loup_finder),
-		loup_finder2_(loup_finder2), buffer_(buffer), obj_rel_prec_f_(rel_eps_f),
-		obj_abs_prec_f_(abs_eps_f), eps_x_(eps_x), lf_loop_ratio_(default_lf_loop_ratio) {
+		n(n), goal_var(goal_var), buffer_(buffer), stealing_buffer_(dynamic_cast<CellWorkStealingHeap*>(&buffer)),
+		obj_rel_prec_f_(rel_eps_f),
+		obj_abs_prec_f_(abs_eps_f), eps_x_(eps_x), lf_loop_ratio_(default_lf_loop_ratio), incumbent_(&own_incumbent_) {
 	assert(n == goal_var);
+	workers_.emplace_back(ctc, bisector, loup_finder, loup_finder2);
+}
+
+void SIPOptimizer::add_worker(Ctc& ctc, Bsc& bisector, LoupFinder& loup_finder, LoupFinder& loup_finder2) {
+	workers_.emplace_back(ctc, bisector, loup_finder, loup_finder2);
+}
+
+void SIPOptimizer::share(SIPIncumbent& incumbent, std::atomic<bool>& stop) {
+	incumbent_ = &incumbent;
+	shared_stop_ = &stop;
+}
+
+int SIPOptimizer::nb_threads() const {
+	return workers_.size();
 }
 
 SIPOptimizer::Status SIPOptimizer::optimize(const IntervalVector& box, double obj_init_bound) {
+	Cell* root = init_search(box, obj_init_bound);
+	const IntervalVector initial_box = root->box;
+	Timer timer;
+	timer.start();
+	start_time_ = std::chrono::steady_clock::now();
+	handle_cell(workers_[0], *root, initial_box);
+	return search(initial_box, timer);
+}
+
+SIPOptimizer::Status SIPOptimizer::resume(const IntervalVector& box, const std::string& filename) {
+	const std::string data = SIPCheckpoint::read_file(filename);
+	BinaryReader reader(data);
+	SIPCheckpoint checkpoint;
+	checkpoint.deserialize(reader);
+	if (checkpoint.ext_nb_var != box.size() + 1) {
+		ibex_error("SIPOptimizer: the checkpoint was written for another problem");
+	}
+	Cell* root = init_search(box, checkpoint.initial_loup);
+	const IntervalVector initial_box = root->box;
+	incumbent_->improve(checkpoint.loup, checkpoint.loup_point);
+	uplo_ = checkpoint.uplo;
+	uplo_epsboxes = checkpoint.uplo_epsboxes;
+	nb_cells_ = checkpoint.nb_cells;
+	iter_ = checkpoint.iter;
+	resumed_time_ = checkpoint.time;
+	time_ = checkpoint.time;
+	last_checkpoint_time_ = checkpoint.time;
+	// The open cells get the properties of the root, with their own box and node data
+	for (long i = 0; i < checkpoint.nb_open_cells; ++i) {
+		buffer_.push(CellSerializer::deserialize(reader, *root));
+	}
+	delete root;
+	if (!reader.at_end()) {
+		ibex_error("SIPOptimizer: unexpected data at the end of the checkpoint");
+	}
+	Timer timer;
+	timer.start();
+	start_time_ = std::chrono::steady_clock::now();
+	return search(initial_box, timer);
+}
+
+void SIPOptimizer::set_checkpoint(const std::string& filename, double period) {
+	// A checkpoint pops all the open cells: the spilled ones would be read back in memory
+	if (dynamic_cast<CellSpillingHeapSIP*>(&buffer_) != nullptr) {
+		ibex_error("SIPOptimizer: checkpoints cannot be written with a CellSpillingHeapSIP buffer");
+	}
+	checkpoint_writer_.reset(new AsyncCheckpointWriter(filename));
+	checkpoint_period_ = period;
+}
+
+Cell* SIPOptimizer::init_search(const IntervalVector& box, double obj_init_bound) {
+	if (checkpoint_writer_ && nb_threads() > 1 && !deterministic) {
+		ibex_error("SIPOptimizer: checkpoints require a sequential or deterministic search");
+	}
 	int ext_n = box.size() + 1;
-	loup_ = obj_init_bound;
+	if (incumbent_ == &own_incumbent_) {
+		incumbent_->reset(obj_init_bound, box);
+	} else {
+		// The other members of the portfolio may already have found a better loup
+		incumbent_->improve(obj_init_bound, box);
+	}
 	// Initialize the loup for the buffer
-	buffer_.contract(loup_);
+	buffer_.contract(obj_init_bound);
+	contracted_loup_ = obj_init_bound;
 	uplo_ = NEG_INFINITY;
 	uplo_epsboxes = POS_INFINITY;
 	nb_cells_ = 0;
-	int iter = 0;
+	iter_ = 0;
+	nb_busy_ = 0;
+	stop_ = false;
+	frozen_loup_ = false;
+	in_flight_.clear();
+	worker_error_ = nullptr;
+	resumed_time_ = 0;
+	last_checkpoint_time_ = 0;
 	buffer_.flush();
 
 	IntervalVector initial_box(ext_n);
@@ -68,72 +161,84 @@ SIPOptimizer::Status SIPOptimizer::optimize(const IntervalVector& box, double ob
 	initial_box[ext_n - 1] = Interval::all_reals();
 	Cell* root = new Cell(initial_box);
 	//root->prop.add(new BxpNodeData());
-	bisector_.add_property(initial_box, root->prop);
+	// The properties are the same for all the workers
+	Worker& main_worker = workers_[0];
+	main_worker.bisector.add_property(initial_box, root->prop);
 	buffer_.add_property(initial_box, root->prop);
-	ctc_.add_property(initial_box, root->prop);
-	loup_finder_.add_property(initial_box, root->prop);
-	loup_finder2_.add_property(initial_box, root->prop);
-	loup_changed_ = false;
+	main_worker.ctc.add_property(initial_box, root->prop);
+	main_worker.loup_finder.add_property(initial_box, root->prop);
+	main_worker.loup_finder2.add_property(initial_box, root->prop);
+	for (Worker& worker : workers_) {
+		worker.loup = obj_init_bound;
+		worker.loup_point = box;
+		worker.loup_changed = false;
+	}
 	initial_loup_ = obj_init_bound;
-	loup_point_ = box;
 	time_ = 0;
-	Timer timer;
-	timer.start();
-	handle_cell(*root, initial_box);
+	return root;
+}
+
+SIPOptimizer::Status SIPOptimizer::search(const IntervalVector& initial_box, Timer& timer) {
+	Worker& main_worker = workers_[0];
+	contract_buffer();
 	updateUplo();
 
 	cout << setprecision(12);
-	//maxiter_ = 7;
-	while (!buffer_.empty() && (timeout <= 0 || time_ < timeout) && (maxiter < 0 || iter < maxiter)) {
-		++iter;
-		loup_changed_ = false;
-		Cell* cell = buffer_.top();
-		if (trace >= 2) {
-			cout << " current box " << cell->box << endl;
-		}
-		try {
-            /*BisectionPoint bisection_point = bisector_.choose_var(*cell);
-           auto new_cells = cell->bisect(bisection_point);*/
-		    std::pair<Cell*,Cell*> new_cells = bisector_.bisect(*cell);
-			buffer_.pop();
-			delete cell;
-			nb_cells_ += 2;
-			handle_cell(*new_cells.first, initial_box);
-			handle_cell(*new_cells.second, initial_box);
-			//handleCell(*cell);
-		} catch (NoBisectableVariableException&) {
-			updateUploEpsboxes((cell->box)[ext_n-1].lb());
+	if (nb_threads() == 1) {
+		//maxiter_ = 7;
+		while (!buffer_.empty() && !search_limit_reached(iter_)) {
+			++iter_;
+			Cell* cell = buffer_.top();
+			if (trace >= 2) {
+				cout << " current box " << cell->box << endl;
+			}
 			buffer_.pop();
-			delete cell;
-			updateUplo();
-			continue;
-		}
+			vector<Cell*> children;
+			if (process_cell(main_worker, cell, initial_box, children)) {
+				nb_cells_ += 2;
+			}
+			for (Cell* child : children) {
+				buffer_.push(child);
+			}
+			if (stealing_buffer_ != nullptr) {
+				stealing_buffer_->release();
+			}
 
-		if (uplo_epsboxes == NEG_INFINITY) {
-			cout << " possible infinite minimum " << endl;
-			break;
-		}
-		if (loup_changed_) {
-			double ymax = compute_ymax();
-			buffer_.contract(ymax);
-			if (ymax <= NEG_INFINITY) {
-				if (trace > 0) {
-					cout << " infinite value for the minimum " << endl;
-					break;
-				}
+			if (uplo_epsboxes == NEG_INFINITY) {
+				cout << " possible infinite minimum " << endl;
+				break;
+			}
+			if (contract_buffer()) {
+				break;
 			}
+			updateUplo();
+			time_ = elapsed_time(timer);
+			checkpoint_if_due();
 		}
-		updateUplo();
-		time_ = timer.get_time();
+	} else if (deterministic) {
+		run_rounds(initial_box, timer);
+	} else {
+		run_workers(initial_box, timer);
 	}
-	time_ = timer.get_time();
+	time_ = elapsed_time(timer);
 	timer.stop();
+	if (worker_error_) {
+		std::rethrow_exception(worker_error_);
+	}
+	if (checkpoint_writer_) {
+		// The open cells of a stopped search can be resumed
+		write_checkpoint();
+		checkpoint_writer_->flush();
+	}
+	const double loup = get_loup();
 	if (timeout > 0 && time_ > timeout) {
 		status_ = Status::TIMEOUT;
+	} else if (interrupted()) {
+		status_ = Status::INTERRUPTED;
 	} else if (uplo_epsboxes == POS_INFINITY
-			&& (loup_ == POS_INFINITY || (loup_ == initial_loup_ && obj_abs_prec_f_ == 0 && obj_rel_prec_f_ == 0))) {
+			&& (loup == POS_INFINITY || (loup == initial_loup_ && obj_abs_prec_f_ == 0 && obj_rel_prec_f_ == 0))) {
 		status_ = Status::INFEASIBLE;
-	} else if (loup_ == initial_loup_) {
+	} else if (loup == initial_loup_) {
 		status_ = Status::NO_FEASIBLE_FOUND;
 	} else if (uplo_epsboxes == NEG_INFINITY) {
 		status_ = Status::UNBOUNDED_OBJ;
@@ -142,11 +247,357 @@ SIPOptimizer::Status SIPOptimizer::optimize(const IntervalVector& box, double ob
 	} else {
 		status_ = Status::SUCCESS;
 	}
+	// A proof ends the search of the whole portfolio
+	if (shared_stop_ != nullptr && (status_ == Status::SUCCESS || status_ == Status::INFEASIBLE)) {
+		shared_stop_->store(true);
+	}
 	return status_;
 }
 
-void SIPOptimizer::handle_cell(Cell& c, const IntervalVector& init_box) {
-	contract_and_bound(c, init_box);
+void SIPOptimizer::run_workers(const IntervalVector& init_box, Timer& timer) {
+	vector<std::thread> threads;
+	if (stealing_buffer_ != nullptr) {
+		for (int i = 1; i < nb_threads(); ++i) {
+			threads.emplace_back(&SIPOptimizer::stealing_worker_loop, this, i, std::cref(init_box), std::ref(timer));
+		}
+		stealing_worker_loop(0, init_box, timer);
+		// Cells left by a stopped search go back to the heap of the main thread
+		stealing_buffer_->attach(0);
+	} else {
+		for (int i = 1; i < nb_threads(); ++i) {
+			threads.emplace_back(&SIPOptimizer::worker_loop, this, std::ref(workers_[i]), std::cref(init_box),
+					std::ref(timer));
+		}
+		worker_loop(workers_[0], init_box, timer);
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+}
+
+void SIPOptimizer::stealing_worker_loop(int index, const IntervalVector& init_box, Timer& timer) {
+	Worker& worker = workers_[index];
+	CellWorkStealingHeap& buffer = *stealing_buffer_;
+	buffer.attach(index);
+	while (!stop_) {
+		// The cell stays in the minimum of the buffer until it is released
+		Cell* cell = buffer.pop();
+		if (cell == nullptr) {
+			if (buffer.idle()) {
+				break;
+			}
+			std::this_thread::yield();
+			continue;
+		}
+		if (trace >= 2) {
+			std::lock_guard<std::mutex> trace_lock(trace_mutex_);
+			cout << " current box " << cell->box << endl;
+		}
+
+		vector<Cell*> children;
+		bool bisected = false;
+		try {
+			bisected = process_cell(worker, cell, init_box, children);
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(buffer_mutex_);
+			if (!worker_error_) {
+				worker_error_ = std::current_exception();
+			}
+			stop_ = true;
+			break;
+		}
+		// The children may have been bounded with an older loup
+		const double loup = incumbent_->loup();
+		const double ymax = (loup == POS_INFINITY) ? POS_INFINITY : compute_ymax(loup);
+		for (Cell* child : children) {
+			if (child->box[goal_var].lb() > ymax) {
+				delete child;
+			} else {
+				buffer.push(child);
+			}
+		}
+		buffer.release();
+
+		std::lock_guard<std::mutex> lock(buffer_mutex_);
+		++iter_;
+		if (bisected) {
+			nb_cells_ += 2;
+		}
+		if (uplo_epsboxes == NEG_INFINITY) {
+			if (!stop_) {
+				cout << " possible infinite minimum " << endl;
+			}
+			stop_ = true;
+		} else if (contract_buffer()) {
+			stop_ = true;
+		} else {
+			updateUplo();
+		}
+		time_ = elapsed_time(timer);
+		if (search_limit_reached(iter_)) {
+			stop_ = true;
+		}
+	}
+	buffer.release();
+}
+
+void SIPOptimizer::worker_loop(Worker& worker, const IntervalVector& init_box, Timer& timer) {
+	std::unique_lock<std::mutex> lock(buffer_mutex_);
+	while (true) {
+		// An empty buffer is final only when no other thread can push new cells
+		buffer_cond_.wait(lock, [this] {return stop_ || !buffer_.empty() || nb_busy_ == 0;});
+		if (stop_ || buffer_.empty() || search_limit_reached(iter_)) {
+			break;
+		}
+		++iter_;
+		Cell* cell = buffer_.top();
+		if (trace >= 2) {
+			std::lock_guard<std::mutex> trace_lock(trace_mutex_);
+			cout << " current box " << cell->box << endl;
+		}
+		buffer_.pop();
+		// The cell is not in the buffer anymore but its lower bound still counts for the uplo
+		auto in_flight = in_flight_.insert(cell->box[goal_var].lb());
+		++nb_busy_;
+		lock.unlock();
+
+		vector<Cell*> children;
+		bool bisected = false;
+		try {
+			bisected = process_cell(worker, cell, init_box, children);
+		} catch (...) {
+			lock.lock();
+			if (!worker_error_) {
+				worker_error_ = std::current_exception();
+			}
+			stop_ = true;
+			in_flight_.erase(in_flight);
+			--nb_busy_;
+			break;
+		}
+
+		lock.lock();
+		if (bisected) {
+			nb_cells_ += 2;
+		}
+		for (Cell* child : children) {
+			buffer_.push(child);
+		}
+		in_flight_.erase(in_flight);
+		--nb_busy_;
+
+		if (uplo_epsboxes == NEG_INFINITY) {
+			if (!stop_) {
+				cout << " possible infinite minimum " << endl;
+			}
+			stop_ = true;
+		} else if (contract_buffer()) {
+			stop_ = true;
+		} else {
+			updateUplo();
+		}
+		time_ = elapsed_time(timer);
+		buffer_cond_.notify_all();
+	}
+	stop_ = true;
+	buffer_cond_.notify_all();
+}
+
+void SIPOptimizer::run_rounds(const IntervalVector& init_box, Timer& timer) {
+	const int nb_workers = nb_threads();
+	vector<Cell*> round(nb_workers);
+	vector<vector<Cell*>> children(nb_workers);
+	vector<char> bisected(nb_workers);
+	vector<std::exception_ptr> errors(nb_workers);
+	auto run = [&](int w) {
+		ParameterPointPool::set_worker(w);
+		try {
+			bisected[w] = process_cell(workers_[w], round[w], init_box, children[w]);
+		} catch (...) {
+			errors[w] = std::current_exception();
+		}
+	};
+
+	// Persistent threads: a round only processes one cell per thread
+	if (round_pool_ == nullptr || round_pool_->nb_threads() != nb_workers) {
+		round_pool_.reset(new PavingThreadPool(nb_workers));
+		round_pool_->threshold = 1;
+	}
+
+	frozen_loup_ = true;
+	while (!buffer_.empty() && !search_limit_reached(iter_)) {
+		int count = 0;
+		while (count < nb_workers && !buffer_.empty() && (maxiter < 0 || iter_ < maxiter)) {
+			++iter_;
+			round[count] = buffer_.top();
+			if (trace >= 2) {
+				cout << " current box " << round[count]->box << endl;
+			}
+			buffer_.pop();
+			++count;
+		}
+		// All the workers of a round start from the same loup
+		const double loup = incumbent_->loup();
+		const IntervalVector loup_point = incumbent_->point();
+		for (int w = 0; w < count; ++w) {
+			workers_[w].loup = loup;
+			workers_[w].loup_point = loup_point;
+			children[w].clear();
+		}
+		// The worst-case parameters found during the round are shared at its end
+		if (point_pool != nullptr) {
+			point_pool->freeze(count);
+		}
+		// One cell per slot: the worker w processes the cell w
+		round_pool_->parallel_for(count, [&run](int begin, int end, int slot) {
+			for (int w = begin; w < end; ++w) {
+				run(w);
+			}
+		});
+		if (point_pool != nullptr) {
+			point_pool->thaw();
+		}
+
+		// Merge in the order of the workers
+		for (int w = 0; w < count; ++w) {
+			if (errors[w]) {
+				worker_error_ = errors[w];
+				frozen_loup_ = false;
+				return;
+			}
+			if (workers_[w].loup < loup) {
+				incumbent_->improve(workers_[w].loup, workers_[w].loup_point);
+			}
+			if (bisected[w]) {
+				nb_cells_ += 2;
+			}
+			for (Cell* child : children[w]) {
+				buffer_.push(child);
+			}
+		}
+		if (stealing_buffer_ != nullptr) {
+			stealing_buffer_->release();
+		}
+
+		if (uplo_epsboxes == NEG_INFINITY) {
+			cout << " possible infinite minimum " << endl;
+			break;
+		}
+		if (contract_buffer()) {
+			break;
+		}
+		updateUplo();
+		time_ = elapsed_time(timer);
+		checkpoint_if_due();
+	}
+	frozen_loup_ = false;
+}
+
+bool SIPOptimizer::search_limit_reached(int iter) const {
+	return (timeout > 0 && time_ >= timeout) || (maxiter >= 0 && iter >= maxiter)
+			|| (shared_stop_ != nullptr && shared_stop_->load());
+}
+
+bool SIPOptimizer::interrupted() const {
+	// Cells left in the buffer when another member of the portfolio has ended the search
+	return shared_stop_ != nullptr && shared_stop_->load() && !buffer_.empty()
+			&& uplo_epsboxes != NEG_INFINITY;
+}
+
+double SIPOptimizer::elapsed_time(Timer& timer) const {
+	// The cpu time of the process also counts the other members of a portfolio
+	if (nb_threads() == 1 && shared_stop_ == nullptr) {
+		return resumed_time_ + timer.get_time();
+	}
+	return resumed_time_ + std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count();
+}
+
+void SIPOptimizer::checkpoint_if_due() {
+	if (checkpoint_writer_ && time_ - last_checkpoint_time_ >= checkpoint_period_) {
+		write_checkpoint();
+	}
+}
+
+void SIPOptimizer::write_checkpoint() {
+	// The buffers cannot be iterated: the cells are popped and pushed back.
+	// Only snapshots are taken here, the writer thread serializes them.
+	auto snapshots = std::make_shared<vector<CellSerializer::Snapshot>>();
+	vector<Cell*> cells;
+	while (!buffer_.empty()) {
+		cells.push_back(buffer_.pop());
+		snapshots->emplace_back(*cells.back());
+	}
+	for (Cell* cell : cells) {
+		buffer_.push(cell);
+	}
+	if (stealing_buffer_ != nullptr) {
+		stealing_buffer_->release();
+	}
+	auto checkpoint = std::make_shared<SIPCheckpoint>();
+	checkpoint->ext_nb_var = n + 1;
+	checkpoint->loup = incumbent_->loup();
+	checkpoint->loup_point = incumbent_->point();
+	checkpoint->initial_loup = initial_loup_;
+	checkpoint->uplo = uplo_;
+	checkpoint->uplo_epsboxes = uplo_epsboxes;
+	checkpoint->nb_cells = nb_cells_;
+	checkpoint->iter = iter_;
+	checkpoint->time = time_;
+	checkpoint->nb_open_cells = snapshots->size();
+	checkpoint_writer_->submit([checkpoint, snapshots]() {
+		BinaryWriter writer;
+		checkpoint->serialize(writer);
+		for (const CellSerializer::Snapshot& snapshot : *snapshots) {
+			CellSerializer::serialize(writer, snapshot);
+		}
+		return std::move(writer.data());
+	});
+	last_checkpoint_time_ = time_;
+}
+
+bool SIPOptimizer::contract_buffer() {
+	const double loup = incumbent_->loup();
+	if (loup >= contracted_loup_) {
+		return false;
+	}
+	contracted_loup_ = loup;
+	double ymax = compute_ymax(loup);
+	buffer_.contract(ymax);
+	if (ymax <= NEG_INFINITY) {
+		if (trace > 0) {
+			cout << " infinite value for the minimum " << endl;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool SIPOptimizer::process_cell(Worker& worker, Cell* cell, const IntervalVector& init_box, vector<Cell*>& children) {
+	worker.loup_changed = false;
+	std::pair<Cell*, Cell*> new_cells;
+	try {
+		/*BisectionPoint bisection_point = bisector_.choose_var(*cell);
+		auto new_cells = cell->bisect(bisection_point);*/
+		new_cells = worker.bisector.bisect(*cell);
+	} catch (NoBisectableVariableException&) {
+		updateUploEpsboxes((cell->box)[goal_var].lb());
+		delete cell;
+		return false;
+	}
+	delete cell;
+	for (Cell* new_cell : { new_cells.first, new_cells.second }) {
+		contract_and_bound(worker, *new_cell, init_box);
+		if (new_cell->box.is_empty()) {
+			delete new_cell;
+		} else {
+			children.push_back(new_cell);
+		}
+	}
+	return true;
+}
+
+void SIPOptimizer::handle_cell(Worker& worker, Cell& c, const IntervalVector& init_box) {
+	contract_and_bound(worker, c, init_box);
 
 	if(c.box.is_empty()) {
 		delete &c;
@@ -155,7 +606,7 @@ void SIPOptimizer::handle_cell(Cell& c, const IntervalVector& init_box) {
 	}
 }
 
-void SIPOptimizer::contract_and_bound(Cell& cell, const IntervalVector& init_box) {
+void SIPOptimizer::contract_and_bound(Worker& worker, Cell& cell, const IntervalVector& init_box) {
 	// LOAD THE NEW CACHE!
 
 	//BxpNodeData* data=(BxpNodeData*) cell.prop[BxpNodeData::id];
@@ -193,11 +644,12 @@ void SIPOptimizer::contract_and_bound(Cell& cell, const IntervalVector& init_box
 
 	// =============== Contract y with y <= loup
 	Interval& y = cell.box[goal_var];
+	double loup = worker_loup(worker);
 	double ymax;
-	if (loup_ == POS_INFINITY)
+	if (loup == POS_INFINITY)
 		ymax = POS_INFINITY;
 	else
-		ymax = compute_ymax()+1e-15;
+		ymax = compute_ymax(loup)+1e-15;
 
 	y &= Interval(NEG_INFINITY, ymax);
 	if (y.is_empty()) {
@@ -211,25 +663,25 @@ void SIPOptimizer::contract_and_bound(Cell& cell, const IntervalVector& init_box
 		cell.prop.update(BoxEvent(cell.box,BoxEvent::CONTRACT,BitSet::singleton(n+1,goal_var)));
 		//cout << "after: " << cell.box << endl << endl << endl;
 		//cout << "beforectc" << endl;
-		double old_loup = loup_;
-		ctc_.contract(cell.box, context);
+		double old_loup = worker_loup(worker);
+		worker.ctc.contract(cell.box, context);
 		if(cell.box.is_empty()) {
 			return;
 		}
 		//cout << "afterctc" << endl;
 		loop = false;
 
-		bool loup_changed_here = updateLoup2(cell);
+		bool loup_changed_here = updateLoup(worker, worker.loup_finder2, cell, " (lf2)");
 		loop = loup_changed_here;
 		if (loup_changed_here) {
-			y &= Interval(NEG_INFINITY, compute_ymax());
+			y &= Interval(NEG_INFINITY, compute_ymax(worker.loup));
 		}
-		loup_changed_ |= loup_changed_here;
+		worker.loup_changed |= loup_changed_here;
 		if (y.is_empty()) {
 			cell.box.set_empty();
 			return;
 		}
-		loop = (old_loup - loup_)/loup_ > lf_loop_ratio_;
+		loop = (old_loup - worker.loup)/worker.loup > lf_loop_ratio_;
 		//loop = false;
 		//break;
 	}
@@ -239,13 +691,13 @@ void SIPOptimizer::contract_and_bound(Cell& cell, const IntervalVector& init_box
 	// we pass the full box with goal to the updateLoup function,
 	// the linearize function won't use the last variable of the box
 	//bool loup_changed_here = updateLoup(box_without_gaol);
-	bool loup_changed_here = updateLoup(cell);
+	bool loup_changed_here = updateLoup(worker, worker.loup_finder, cell, "(lf1)");
 	//bool loup_changed_here = false;
 	if (loup_changed_here) {
-		y &= Interval(NEG_INFINITY, compute_ymax());
+		y &= Interval(NEG_INFINITY, compute_ymax(worker.loup));
 		cell.prop.update(BoxEvent(cell.box,BoxEvent::CONTRACT,BitSet::singleton(n+1,goal_var)));
 	}
-	loup_changed_ |= loup_changed_here;
+	worker.loup_changed |= loup_changed_here;
 	if (y.is_empty()) {
 		cell.box.set_empty();
 		return;
@@ -262,12 +714,27 @@ void SIPOptimizer::contract_and_bound(Cell& cell, const IntervalVector& init_box
 }
 
 void SIPOptimizer::updateUplo() {
-	double new_uplo = POS_INFINITY;
+	// Other threads may lower the loup at any time: use the one the buffer is contracted with
+	const double loup = contracted_loup_;
+	const double ymax = (loup == POS_INFINITY) ? POS_INFINITY : compute_ymax(loup);
 
-	if (!buffer_.empty()) {
+	// Smallest lower bound of the cells still to process, including the ones being processed
+	double new_uplo = POS_INFINITY;
+	if (stealing_buffer_ != nullptr) {
+		new_uplo = stealing_buffer_->minimum();
+	} else if (!buffer_.empty()) {
 		new_uplo = buffer_.minimum();
-		if (new_uplo > loup_) {
-			cout << " loup = " << loup_ << " new_uplo=" << new_uplo << endl;
+	}
+	if (!in_flight_.empty()) {
+		new_uplo = std::min(new_uplo, *in_flight_.begin());
+	}
+	// With several threads, cells bounded with an older loup may still be pending:
+	// they are above ymax and will be discarded.
+	const bool pending = new_uplo < POS_INFINITY && (nb_threads() == 1 || new_uplo <= ymax);
+
+	if (pending) {
+		if (new_uplo > loup) {
+			cout << " loup = " << loup << " new_uplo=" << new_uplo << endl;
 			ibex_error("optimizer: new_uplo>loup (please report bug)");
 		}
 		if (new_uplo < uplo_) {
@@ -278,49 +745,49 @@ void SIPOptimizer::updateUplo() {
 			if (new_uplo > uplo_) {
 				uplo_ = new_uplo;
 				if (trace > 0) {
+					std::lock_guard<std::mutex> lock(trace_mutex_);
 					cout << "\033[33m uplo= " << uplo_ << "\033[0m" << endl;
 				}
 			}
 		} else {
 			uplo_ = uplo_epsboxes;
 		}
-	} else if (buffer_.empty() && loup_ != POS_INFINITY) {
-		new_uplo = compute_ymax();
-		double m = (new_uplo < uplo_epsboxes) ? new_uplo : uplo_epsboxes;
+	} else if (loup != POS_INFINITY) {
+		new_uplo = ymax;
+		double m = (new_uplo < uplo_epsboxes) ? new_uplo : uplo_epsboxes.load();
 		if (uplo_ < m) {
 			uplo_ = m;
 		}
 	}
 }
 
-bool SIPOptimizer::updateLoup(Cell& cell) {
-	if (cell.box.is_empty())
-		return false;
-	try {
-		auto p = loup_finder_.find(sip_from_ext_box(cell.box), loup_point_, loup_, cell.prop);
-		loup_point_ = p.first; // -2 to remove the goal variable
-		loup_ = p.second;
-		if (trace > 0) {
-			cout << "                    ";
-			cout << "\033[32m loup= " << loup_ << "(lf1)\033[0m" << endl;
-
+double SIPOptimizer::worker_loup(Worker& worker) {
+	if (!frozen_loup_) {
+		const double loup = incumbent_->loup();
+		if (loup < worker.loup) {
+			worker.loup = loup;
+			worker.loup_point = incumbent_->point();
 		}
-		return true;
-	} catch (LoupFinder::NotFound&) {
-		return false;
 	}
+	return worker.loup;
 }
 
-bool SIPOptimizer::updateLoup2(Cell& cell) {
+bool SIPOptimizer::updateLoup(Worker& worker, LoupFinder& loup_finder, Cell& cell, const char* name) {
 	if (cell.box.is_empty())
 		return false;
 	try {
-		auto p = loup_finder2_.find(sip_from_ext_box(cell.box), loup_point_, loup_, cell.prop);
-		loup_point_ = p.first; // -2 to remove the goal variable
-		loup_ = p.second;
+		const double loup = worker_loup(worker);
+		auto p = loup_finder.find(sip_from_ext_box(cell.box), worker.loup_point, loup, cell.prop);
+		worker.loup_point = p.first; // -2 to remove the goal variable
+		worker.loup = p.second;
+		// In deterministic rounds, the improvements are published at the end of the round
+		if (!frozen_loup_) {
+			incumbent_->improve(worker.loup, worker.loup_point);
+		}
 		if (trace > 0) {
+			std::lock_guard<std::mutex> lock(trace_mutex_);
 			cout << "                    ";
-			cout << "\033[32m loup= " << loup_ << " (lf2)\033[0m" << endl;
+			cout << "\033[32m loup= " << worker.loup << name << "\033[0m" << endl;
 
 		}
 		return true;
@@ -330,11 +797,20 @@ bool SIPOptimizer::updateLoup2(Cell& cell) {
 }
 
 void SIPOptimizer::updateUploEpsboxes(double ymin) {
-	if (uplo_epsboxes > ymin) {
-		uplo_epsboxes = ymin;
-		if (trace > 0) {
-			cout << " unprocessable tiny box: now uplo <=" << setprecision(12) << uplo_epsboxes << " uplo= " << uplo_
-					<< endl;
+	double current = uplo_epsboxes.load();
+	while (current > ymin) {
+		if (uplo_epsboxes.compare_exchange_weak(current, ymin)) {
+			if (trace > 0) {
+				double uplo;
+				{
+					std::lock_guard<std::mutex> lock(buffer_mutex_);
+					uplo = uplo_;
+				}
+				std::lock_guard<std::mutex> lock(trace_mutex_);
+				cout << " unprocessable tiny box: now uplo <=" << setprecision(12) << ymin << " uplo= " << uplo
+						<< endl;
+			}
+			break;
 		}
 	}
 }
@@ -366,16 +842,20 @@ void SIPOptimizer::report(bool verbose) {
 		break;
 	case UNREACHED_PREC:
 		cout << "\033[31m" << " unreached precision" << endl;
+		break;
+	case INTERRUPTED:
+		cout << "\033[31m" << " interrupted by another member of the portfolio" << endl;
 	}
 
 	cout << "\033[0m" << endl;
 
 	// No solution found and optimization stopped with empty buffer  before the required precision is reached => means infeasible problem
+	const double loup = get_loup();
 	if (buffer_.empty() && uplo_epsboxes == POS_INFINITY
-			&& (loup_ == POS_INFINITY || (loup_ == initial_loup_ && obj_abs_prec_f_ == 0 && obj_rel_prec_f_ == 0))) {
+			&& (loup == POS_INFINITY || (loup == initial_loup_ && obj_abs_prec_f_ == 0 && obj_rel_prec_f_ == 0))) {
 		cout << " infeasible problem " << endl;
 	} else {
-		cout << " best bound in: [" << uplo_ << "," << loup_ << "]" << endl;
+		cout << " best bound in: [" << uplo_ << "," << loup << "]" << endl;
 
 		double rel_prec = get_obj_rel_prec();
 		double abs_prec = get_obj_abs_prec();
@@ -386,21 +866,24 @@ void SIPOptimizer::report(bool verbose) {
 		cout << " absolute precision obtained on objective function: " << abs_prec << " "
 				<< (abs_prec <= obj_abs_prec_f_ ? " [passed]" : " [failed]") << endl;
 
-		if (loup_ == initial_loup_)
+		if (loup == initial_loup_)
 			cout << " no feasible point found " << endl;
 		else {
 			cout << " best feasible point: ";
 
-			cout << loup_point_.lb() << endl;
+			cout << get_loup_point().lb() << endl;
 		}
 	}
 	cout << " cpu time used: " << time_ << "s." << endl;
 	cout << " number of cells: " << nb_cells_ << endl;
+	if (nb_threads() > 1) {
+		cout << " number of threads: " << nb_threads() << (deterministic ? " (deterministic)" : "") << endl;
+	}
 
 }
 
 double SIPOptimizer::get_loup() const {
-	return loup_;
+	return incumbent_->loup();
 }
 
 double SIPOptimizer::get_uplo() const {
@@ -412,7 +895,7 @@ SIPOptimizer::Status SIPOptimizer::get_status() const {
 }
 
 IntervalVector SIPOptimizer::get_loup_point() const {
-	return loup_point_;
+	return incumbent_->point();
 }
 
 double SIPOptimizer::get_time() const {
@@ -424,26 +907,27 @@ double SIPOptimizer::get_nb_cells() const {
 }
 
 double SIPOptimizer::get_obj_abs_prec() const {
-	return loup_ - uplo_;
+	return get_loup() - uplo_;
 }
 
 double SIPOptimizer::get_obj_rel_prec() const {
-	if (loup_ == POS_INFINITY)
+	const double loup = get_loup();
+	if (loup == POS_INFINITY)
 		return POS_INFINITY;
-	else if (loup_ == 0)
+	else if (loup == 0)
 		if (uplo_ < 0)
 			return POS_INFINITY;
 		else
 			return 0;
 	else
-		return (loup_ - uplo_) / (fabs(loup_));
+		return (loup - uplo_) / (fabs(loup));
 
 }
 
-double SIPOptimizer::compute_ymax() {
-	double ymax = loup_ - obj_rel_prec_f_ * fabs(loup_);
-	if (loup_ - obj_abs_prec_f_ < ymax)
-		ymax = loup_ - obj_abs_prec_f_;
+double SIPOptimizer::compute_ymax(double loup) const {
+	double ymax = loup - obj_rel_prec_f_ * fabs(loup);
+	if (loup - obj_abs_prec_f_ < ymax)
+		ymax = loup - obj_abs_prec_f_;
 	return ymax;
 }
 
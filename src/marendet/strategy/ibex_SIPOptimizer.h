@@ -12,18 +12,34 @@
 #ifndef __SIP_IBEX_SIPOPTIMIZER_H__
 #define __SIP_IBEX_SIPOPTIMIZER_H__
 
+#include "ibex_CellWorkStealingHeap.h"
 #include "ibex_Ctc.h"
 #include "ibex_LoupFinderSIP.h"
+#include "ibex_PavingThreadPool.h"
+#include "ibex_SIPCheckpoint.h"
+#include "ibex_SIPIncumbent.h"
 
 #include "ibex_Bsc.h"
 #include "ibex_Cell.h"
 #include "ibex_CellBufferOptim.h"
 #include "ibex_Interval.h"
 #include "ibex_IntervalVector.h"
+#include "ibex_Timer.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
 
 namespace ibex {
+class ParameterPointPool;
+
 class SIPOptimizer {
 
 public:
@@ -33,7 +49,8 @@ public:
 		INFEASIBLE,
 		NO_FEASIBLE_FOUND,
 		UNBOUNDED_OBJ,
-		UNREACHED_PREC
+		UNREACHED_PREC,
+		INTERRUPTED
 	};
 
 	static const double default_rel_eps_f;
@@ -47,9 +64,61 @@ public:
 			double rel_eps_f=default_rel_eps_f,
 			double abs_eps_f=default_abs_eps_f);
 
+	/**
+	 * \brief Add a search thread.
+	 *
+	 * The search is multi-threaded as soon as a worker is added, the
+	 * objects given to the constructor being used by the first thread.
+	 * With a CellWorkStealingHeap, the threads share the buffer without
+	 * locking it as a whole.
+	 * ibex Functions are not reentrant: the contractor, the bisector and
+	 * the loup finders of each worker must be built on their own SIPSystem
+	 * (see SIPSystem::clone).
+	 */
+	void add_worker(Ctc& ctc, Bsc& bisector, LoupFinder& loup_finder, LoupFinder& loup_finder2);
+
+	/**
+	 * \brief Share the loup, the loup point and the end of the search with other optimizers.
+	 *
+	 * Used by a portfolio of optimizers running different strategies on the
+	 * same problem, each one in its own thread. The loups found by a member
+	 * bound the search of all the others. A member that proves the required
+	 * precision (or the infeasibility) sets \a stop, and the other members
+	 * then return with the INTERRUPTED status.
+	 * \a incumbent is not reset by optimize: the caller resets it before
+	 * the members start.
+	 */
+	void share(SIPIncumbent& incumbent, std::atomic<bool>& stop);
+
+	/** \brief Number of search threads. */
+	int nb_threads() const;
+
 	SIPOptimizer::Status optimize(const IntervalVector& init_box, double obj_init_bound =
 	POS_INFINITY);
 
+	/**
+	 * \brief Resume the search saved in the checkpoint file \a filename.
+	 *
+	 * The checkpoint must have been written (see set_checkpoint) by a search
+	 * of the same problem, from the same initial box. The search restarts with
+	 * the open cells, the loup, the uplo and the counters of the checkpoint.
+	 */
+	SIPOptimizer::Status resume(const IntervalVector& init_box, const std::string& filename);
+
+	/**
+	 * \brief Write a checkpoint of the search in \a filename every \a period seconds.
+	 *
+	 * Between two cells (two rounds in deterministic mode), the open cells are
+	 * popped and pushed back, keeping a snapshot of each one: its box and its
+	 * node data, whose pavings are shared copy-on-write. The snapshots are
+	 * serialized and written by a background thread, so the search only pauses
+	 * for the pops and the pushes.
+	 * A last checkpoint is written when the search stops. Not available when
+	 * several threads run freely (see deterministic), nor with a
+	 * CellSpillingHeapSIP buffer (all its cells would be read back in memory).
+	 */
+	void set_checkpoint(const std::string& filename, double period);
+
 	void report(bool verbose = true);
 	double get_loup() const;
 	double get_uplo() const;
@@ -66,21 +135,70 @@ public:
 	double timeout = -1;
 	int maxiter = -1;
 
+	/**
+	 * \brief Make a multi-threaded search reproducible.
+	 *
+	 * Cells are processed by rounds of one cell per thread. The loup is
+	 * frozen during a round and the results are merged in the order of
+	 * the threads, so the search does not depend on thread scheduling.
+	 * The threads of the rounds are kept from one round to the next; the
+	 * parameter-paving sweeps of a thread other than the calling one are
+	 * sequential (see PavingThreadPool).
+	 */
+	bool deterministic = false;
+
+	/**
+	 * \brief Pool of worst-case parameters of the system, nullptr if none.
+	 *
+	 * Needed by a deterministic search: the pool is frozen during each round
+	 * (see ParameterPointPool::freeze).
+	 */
+	ParameterPointPool* point_pool = nullptr;
+
 private:
-	double compute_ymax();
-	void handle_cell(Cell& c, const IntervalVector& init_box);
-	void contract_and_bound(Cell& c, const IntervalVector& init_box);
+	/**
+	 * \brief Objects used by one search thread.
+	 */
+	struct Worker {
+		Worker(Ctc& ctc, Bsc& bisector, LoupFinder& loup_finder, LoupFinder& loup_finder2);
+
+		Ctc& ctc;
+		Bsc& bisector;
+		LoupFinder& loup_finder;
+		LoupFinder& loup_finder2;
+
+		/* Loup known by this thread: a copy of the shared one, frozen during deterministic rounds */
+		double loup;
+		IntervalVector loup_point;
+		bool loup_changed;
+	};
+
+	Cell* init_search(const IntervalVector& init_box, double obj_init_bound);
+	SIPOptimizer::Status search(const IntervalVector& initial_box, Timer& timer);
+	double compute_ymax(double loup) const;
+	void handle_cell(Worker& worker, Cell& c, const IntervalVector& init_box);
+	bool process_cell(Worker& worker, Cell* cell, const IntervalVector& init_box, std::vector<Cell*>& children);
+	void contract_and_bound(Worker& worker, Cell& c, const IntervalVector& init_box);
+	void run_workers(const IntervalVector& init_box, Timer& timer);
+	void worker_loop(Worker& worker, const IntervalVector& init_box, Timer& timer);
+	void stealing_worker_loop(int index, const IntervalVector& init_box, Timer& timer);
+	void run_rounds(const IntervalVector& init_box, Timer& timer);
+	bool contract_buffer();
+	bool search_limit_reached(int iter) const;
+	bool interrupted() const;
+	double elapsed_time(Timer& timer) const;
 	void updateUplo();
-	bool updateLoup(Cell& cell);
-	bool updateLoup2(Cell& cell);
+	double worker_loup(Worker& worker);
+	bool updateLoup(Worker& worker, LoupFinder& loup_finder, Cell& cell, const char* name);
 
 	void updateUploEpsboxes(double ymin);
+	void checkpoint_if_due();
+	void write_checkpoint();
 
-	Ctc& ctc_;
-	Bsc& bisector_;
-	LoupFinder& loup_finder_;
-	LoupFinder& loup_finder2_;
+	std::vector<Worker> workers_;
 	CellBufferOptim& buffer_;
+	/* buffer_, if it is a work-stealing one */
+	CellWorkStealingHeap* stealing_buffer_;
 
 	const double obj_rel_prec_f_;
 	const double obj_abs_prec_f_;
@@ -89,13 +207,44 @@ private:
 
 	SIPOptimizer::Status status_ = SIPOptimizer::Status::SUCCESS;
 	double uplo_ = NEG_INFINITY;
-	double loup_ = POS_INFINITY;
+	SIPIncumbent own_incumbent_;
+	/* own_incumbent_, or the one shared by a portfolio */
+	SIPIncumbent* incumbent_;
+	/* Set by the member of a portfolio that ends the search, nullptr if not shared */
+	std::atomic<bool>* shared_stop_ = nullptr;
 	double initial_loup_ = POS_INFINITY;
-	double uplo_epsboxes = POS_INFINITY;
+	std::atomic<double> uplo_epsboxes { POS_INFINITY };
 	double time_ = 0;
-	IntervalVector loup_point_ = IntervalVector(1);
 	int nb_cells_ = 0;
-	bool loup_changed_ = false;
+	/* Time spent before the checkpoint the search was resumed from */
+	double resumed_time_ = 0;
+
+	/* Threads of the deterministic rounds, created by the first round */
+	std::unique_ptr<PavingThreadPool> round_pool_;
+
+	std::unique_ptr<AsyncCheckpointWriter> checkpoint_writer_;
+	double checkpoint_period_ = 0;
+	double last_checkpoint_time_ = 0;
+
+	/* Loup of the last contraction of the buffer */
+	double contracted_loup_ = POS_INFINITY;
+	/* Workers read the loup of their worker struct instead of the shared one */
+	bool frozen_loup_ = false;
+
+	/* State of the multi-threaded search, protected by buffer_mutex_ (except
+	 * the cells of a work-stealing buffer) */
+	std::mutex buffer_mutex_;
+	std::condition_variable buffer_cond_;
+	/* Lower bounds of the objective in the cells being processed */
+	std::multiset<double> in_flight_;
+	int nb_busy_ = 0;
+	int iter_ = 0;
+	std::atomic<bool> stop_ { false };
+	/* Timer measures the cpu time of the process, threads are timed with the wall clock */
+	std::chrono::steady_clock::time_point start_time_;
+	std::exception_ptr worker_error_;
+
+	std::mutex trace_mutex_;
 
 };
 
@@ -120,6 +269,9 @@ inline
         case SIPOptimizer::Status::UNBOUNDED_OBJ:
             os << "UBOUNDED OBJ";
             break;
+        case SIPOptimizer::Status::INTERRUPTED:
+            os << "INTERRUPTED";
+            break;
         }
         return os;
     }
@@ -13,6 +13,7 @@
 
 #include "ibex_CellBufferNeighborhood.h"
 #include "ibex_Cell.h"
+#include "ibex_CellWorkStealingStack.h"
 #include "ibex_Interval.h"
 #include "ibex_NoBisectableVariableException.h"
 #include "ibex_Solver.h"
@@ -22,6 +23,7 @@
 #include <cassert>
 #include <iostream>
 #include <iterator>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -55,6 +57,7 @@ SIPSolver::SIPSolver(const SIPSystem& sys, Ctc& ctc, Bsc& bsc, CellBuffer& buffe
     , manif(NULL)
     , time(0)
     , nb_cells(0)
+    , stop_status_(SIPSolver::SUCCESS)
 {
 
     assert(solve_init_box.size() == ctc.nb_var);
@@ -92,6 +95,15 @@ SIPSolver::SIPSolver(const SIPSystem& sys, Ctc& ctc, Bsc& bsc, CellBuffer& buffe
         boundary_test = SIPSolver::ALL_FALSE;
 
     manif = new SIPManifold(n, m, nb_ineq);
+
+    workers_.emplace_back(sys, ctc, bsc);
+}
+
+SIPSolver::Worker::Worker(const SIPSystem& sys, Ctc& ctc, Bsc& bsc)
+    : sys(sys)
+    , ctc(ctc)
+    , bsc(bsc)
+{
 }
 
 void SIPSolver::set_params(const VarSet& _params)
@@ -99,6 +111,16 @@ void SIPSolver::set_params(const VarSet& _params)
     params = _params;
 }
 
+void SIPSolver::add_worker(const SIPSystem& sys, Ctc& ctc, Bsc& bsc)
+{
+    workers_.emplace_back(sys, ctc, bsc);
+}
+
+int SIPSolver::nb_threads() const
+{
+    return workers_.size();
+}
+
 SIPSolver::~SIPSolver()
 {
     // ineqs is a ref to the original system
@@ -135,6 +157,7 @@ void SIPSolver::start(const IntervalVector& init_box)
     time = 0;
 
     timer.restart();
+    start_time_ = std::chrono::steady_clock::now();
 }
 
 void SIPSolver::start(const char* input_paving)
@@ -174,6 +197,7 @@ void SIPSolver::start(const char* input_paving)
     manif->pending.clear();
 
     timer.restart();
+    start_time_ = std::chrono::steady_clock::now();
 }
 
 SIPSolverOutputBox* SIPSolver::next()
@@ -234,7 +258,7 @@ SIPSolverOutputBox* SIPSolver::next()
             // if the system is under constrained
             if (!c->box.is_empty() && m < n) {
                 // note: cannot return PENDING status
-                SIPSolverOutputBox new_sol = check_sol(*c);
+                SIPSolverOutputBox new_sol = check_sol(*c, *ineqs);
                 if (new_sol.status != SIPSolverOutputBox::UNKNOWN) {
                     if ((m == 0 && new_sol.status == SIPSolverOutputBox::INNER) || !is_too_large(new_sol.existence())) {
                         delete buffer.pop();
@@ -263,7 +287,7 @@ SIPSolverOutputBox* SIPSolver::next()
             }
 
             catch (NoBisectableVariableException&) {
-                SIPSolverOutputBox new_sol = check_sol(*c);
+                SIPSolverOutputBox new_sol = check_sol(*c, *ineqs);
                 delete buffer.pop();
                 return &store_sol(new_sol);
             }
@@ -302,7 +326,11 @@ SIPSolver::Status SIPSolver::solve()
 
     try {
 
-        while (next() != NULL) {
+        if (nb_threads() > 1) {
+            run_workers();
+        } else {
+            while (next() != NULL) {
+            }
         }
 
         if (manif->unknown.size() > 0)
@@ -323,7 +351,10 @@ SIPSolver::Status SIPSolver::solve()
     }
 
     timer.stop();
-    time = timer.get_time();
+    if (nb_threads() > 1)
+        time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count();
+    else
+        time = timer.get_time();
 
     manif->time += time;
     manif->nb_cells += nb_cells;
@@ -331,7 +362,142 @@ SIPSolver::Status SIPSolver::solve()
     return manif->status;
 }
 
-SIPSolverOutputBox SIPSolver::check_sol(const Cell& c)
+void SIPSolver::run_workers()
+{
+    CellWorkStealingStack* stack = dynamic_cast<CellWorkStealingStack*>(&buffer);
+    if (stack == NULL)
+        ibex_error("SIPSolver: several threads require a CellWorkStealingStack");
+    if (pathFinding)
+        ibex_error("SIPSolver: path finding is not available with several threads");
+
+    stop_ = false;
+    nb_busy_ = 0;
+    worker_error_ = nullptr;
+
+    vector<std::thread> threads;
+    for (int i = 1; i < nb_threads(); ++i) {
+        threads.emplace_back(&SIPSolver::worker_loop, this, i);
+    }
+    worker_loop(0);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    // Cells left by a stopped search are flushed by the main thread
+    stack->attach(0);
+
+    if (worker_error_)
+        std::rethrow_exception(worker_error_);
+    if (stop_) {
+        if (stop_status_ == SIPSolver::TIME_OUT)
+            throw TimeOutException();
+        throw CellLimitException();
+    }
+}
+
+void SIPSolver::worker_loop(int index)
+{
+    Worker& worker = workers_[index];
+    CellWorkStealingStack& stack = static_cast<CellWorkStealingStack&>(buffer);
+    stack.attach(index);
+    while (!stop_) {
+        // Limits are checked before a cell is popped: no cell is lost when the search stops
+        if (time_limit > 0
+            && std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count() >= time_limit) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!stop_)
+                stop_status_ = SIPSolver::TIME_OUT;
+            stop_ = true;
+            break;
+        }
+
+        // A thread counts as busy before it pops: the search is over only
+        // when all the stacks are empty and no thread holds a cell.
+        ++nb_busy_;
+        Cell* c = stack.pop();
+        if (c == NULL) {
+            --nb_busy_;
+            if (nb_busy_ == 0 && stack.empty())
+                break;
+            std::this_thread::yield();
+            continue;
+        }
+
+        try {
+            process_cell(worker, c);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!worker_error_)
+                worker_error_ = std::current_exception();
+            stop_ = true;
+        }
+        --nb_busy_;
+    }
+}
+
+void SIPSolver::process_cell(Worker& worker, Cell* c)
+{
+    if (trace == 2) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cout << " current box " << c->box << endl;
+    }
+
+    ContractContext context(c->prop);
+
+    int v = c->bisected_var; // last bisected var.
+
+    if (v != -1) { // not the root node :  impact set to the last bisected variable only
+        context.impact = BitSet::singleton(n, v);
+    }
+
+    try {
+        worker.ctc.contract(c->box, context);
+
+        if (c->box.is_empty())
+            throw EmptyBoxException();
+
+        // certification is performed at each intermediate step
+        // if the system is under constrained
+        if (m < n) {
+            SIPSolverOutputBox new_sol = check_sol(*c, worker.sys);
+            if (new_sol.status != SIPSolverOutputBox::UNKNOWN
+                && ((m == 0 && new_sol.status == SIPSolverOutputBox::INNER) || !is_too_large(new_sol.existence()))) {
+                delete c;
+                std::lock_guard<std::mutex> lock(mutex_);
+                store_sol(new_sol);
+                return;
+            }
+        }
+
+        try {
+            if (is_too_small(c->box))
+                throw NoBisectableVariableException();
+
+            // next line may also throw NoBisectableVariableException
+            pair<Cell*, Cell*> new_cells = worker.bsc.bisect(*c);
+
+            delete c;
+            buffer.push(new_cells.first);
+            buffer.push(new_cells.second);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            nb_cells += 2;
+            if (cell_limit >= 0 && nb_cells >= cell_limit) {
+                if (!stop_)
+                    stop_status_ = SIPSolver::CELL_OVERFLOW;
+                stop_ = true;
+            }
+        } catch (NoBisectableVariableException&) {
+            SIPSolverOutputBox new_sol = check_sol(*c, worker.sys);
+            delete c;
+            std::lock_guard<std::mutex> lock(mutex_);
+            store_sol(new_sol);
+        }
+    } catch (EmptyBoxException&) {
+        delete c;
+    }
+}
+
+SIPSolverOutputBox SIPSolver::check_sol(const Cell& c, const SIPSystem& sys)
 {
 
     SIPSolverOutputBox sol(n);
@@ -390,13 +556,14 @@ SIPSolverOutputBox SIPSolver::check_sol(const Cell& c)
         (SIPSolverOutputBox::sol_status&)sol.status = SIPSolverOutputBox::BOUNDARY;
 
     if (ineqs) {
+        // sys is *ineqs or the copy of the calling thread
         Interval y, r;
-        for (int i = 0; i < ineqs->sic_constraints_.size(); i++) {
+        for (int i = 0; i < sys.sic_constraints_.size(); i++) {
             //NumConstraint& c=ineqs->ctrs[i];
             //assert(c.f.image_dim()==1);
             //y=c.f.eval(sol.existence());
             auto& cache = ((BxpNodeData*)c.prop[BxpNodeData::id])->sic_constraints_caches[i];
-            y = ineqs->sic_constraints_[i].evaluateWithoutCachedValue(sol.existence(), cache);
+            y = sys.sic_constraints_[i].evaluateWithoutCachedValue(sol.existence(), cache);
             //r=c.right_hand_side().i();
             r = Interval::neg_reals(); // Constraint is always scalar and <= 0
             if (y.is_disjoint(r)) {
@@ -407,11 +574,11 @@ SIPSolverOutputBox SIPSolver::check_sol(const Cell& c)
                 (SIPSolverOutputBox::sol_status&)sol.status = SIPSolverOutputBox::BOUNDARY;
             }
         }
-        for (int i = 0; i < ineqs->normal_constraints_.size(); i++) {
+        for (int i = 0; i < sys.normal_constraints_.size(); i++) {
             //NumConstraint& c=ineqs->ctrs[i];
             //assert(c.f.image_dim()==1);
             //y=c.f.eval(sol.existence());
-            y = ineqs->normal_constraints_[i].evaluate(sol.existence());
+            y = sys.normal_constraints_[i].evaluate(sol.existence());
             //r=c.right_hand_side().i();
             r = Interval::neg_reals(); // Constraint is always scalar and <= 0
             if (y.is_disjoint(r)) {
@@ -24,7 +24,11 @@
 #include "ibex_Vector.h"
 #include "ibex_SIPSolverOutputBox.h"
 
+#include <atomic>
+#include <chrono>
 #include <exception>
+#include <mutex>
+#include <vector>
 
 namespace ibex {
 class SIPManifold;
@@ -72,6 +76,23 @@ public:
 	 */
 	void set_params(const VarSet& params);
 
+	/**
+	 * \brief Add a search thread.
+	 *
+	 * The search is multi-threaded as soon as a worker is added, the
+	 * objects given to the constructor being used by the first thread.
+	 * The buffer must then be a CellWorkStealingStack: each thread explores
+	 * depth-first with its own stack. Not available in path finding mode,
+	 * nor in interactive mode (next).
+	 * ibex Functions are not reentrant: the contractor and the bisector of
+	 * each worker must be built on \a sys, a copy of the system (see
+	 * SIPSystem::clone).
+	 */
+	void add_worker(const SIPSystem& sys, Ctc& ctc, Bsc& bsc);
+
+	/** \brief Number of search threads. */
+	int nb_threads() const;
+
 	/**
 	 * \brief Destructor.
 	 */
@@ -210,7 +231,8 @@ public:
 	/**
 	 * \brief Maximum CPU time used by the solver.
 	 *
-	 * This parameter allows to bound running time.
+	 * This parameter allows to bound running time. With several threads,
+	 * the wall-clock time is bounded instead.
 	 * The value can be fixed by the user. By default, it is -1 (no limit).
 	 */
 
@@ -238,6 +260,17 @@ public:
 
 protected:
 
+	/**
+	 * \brief Objects used by one search thread.
+	 */
+	struct Worker {
+		Worker(const SIPSystem& sys, Ctc& ctc, Bsc& bsc);
+
+		const SIPSystem& sys;
+		Ctc& ctc;
+		Bsc& bsc;
+	};
+
 	/**
 	 * \brief Called by constructors.
 	 */
@@ -248,6 +281,26 @@ protected:
 	 */
 	Status solve();
 
+	/**
+	 * \brief Run the search threads until the buffer is empty.
+	 *
+	 * \throw TimeOutException or CellLimitException when a limit is reached,
+	 *        once all the threads have pushed back their cells.
+	 */
+	void run_workers();
+
+	/**
+	 * \brief Search loop of the thread \a index.
+	 */
+	void worker_loop(int index);
+
+	/**
+	 * \brief Contract and bisect a cell popped by a search thread.
+	 *
+	 * The cell is deleted, its children are pushed on the stack of the thread.
+	 */
+	void process_cell(Worker& worker, Cell* c);
+
 	/*
 	 * \brief Return a new "output box" that potentially contains solutions.
 	 * \throw An exception otherwise (no solution inside).
@@ -259,7 +312,7 @@ protected:
 	 * slightly changed (due to inflating Newton) and the actual "solution"
 	 * is stored in the existence box of the output.
 	 */
-	SIPSolverOutputBox check_sol(const Cell& c);
+	SIPSolverOutputBox check_sol(const Cell& c, const SIPSystem& sys);
 
 	/**
 	 * \brief Check if the box is "BOUNDARY"
@@ -350,6 +403,20 @@ protected:
 	 * \brief Number of cells used to obtain this manifold.
 	 */
 	unsigned int nb_cells;
+
+	std::vector<Worker> workers_;
+
+	/* State of the multi-threaded search: the manifold, nb_cells and the
+	 * trace are protected by mutex_ */
+	std::mutex mutex_;
+	/* Threads holding a cell popped from the buffer */
+	std::atomic<int> nb_busy_ { 0 };
+	std::atomic<bool> stop_ { false };
+	/* Status of a stopped search (TIME_OUT or CELL_OVERFLOW) */
+	Status stop_status_;
+	std::exception_ptr worker_error_;
+	/* Timer measures the cpu time of the process, threads are timed with the wall clock */
+	std::chrono::steady_clock::time_point start_time_;
 };
 
 
@@ -0,0 +1,83 @@
+/* ============================================================================
+ * I B E X - ibex_LinearizationCache.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_LinearizationCache.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+string key(int constraint) {
+	return string(reinterpret_cast<const char*>(&constraint), sizeof(constraint));
+}
+}
+
+const int LinearizationCache::max_corners = 4;
+
+LinearizationCache::Entry::Entry() :
+		has_gradient(false), gradient(1) {
+}
+
+const Interval* LinearizationCache::Entry::value(const Vector& corner) const {
+	for (int i = 0; i < (int) corners.size(); ++i) {
+		if (corners[i] == corner) {
+			return &values[i];
+		}
+	}
+	return nullptr;
+}
+
+void LinearizationCache::Entry::set_value(const Vector& corner, const Interval& value) {
+	if ((int) corners.size() >= max_corners) {
+		corners.erase(corners.begin());
+		values.erase(values.begin());
+	}
+	corners.push_back(corner);
+	values.push_back(value);
+}
+
+LinearizationCache::LinearizationCache() :
+		valid_(false), box_(1) {
+}
+
+void LinearizationCache::set_box(const IntervalVector& box) {
+	if (valid_ && box_.size() == box.size() && box_ == box) {
+		return;
+	}
+	clear();
+	box_ = box;
+	valid_ = true;
+}
+
+void LinearizationCache::clear() {
+	valid_ = false;
+	alpha.clear();
+	entries_.clear();
+}
+
+LinearizationCache::Entry& LinearizationCache::entry(int constraint) {
+	return entries_[key(constraint)];
+}
+
+LinearizationCache::Entry& LinearizationCache::entry(int constraint, const Vector& parameter_point) {
+	string k = key(constraint);
+	for (int i = 0; i < parameter_point.size(); ++i) {
+		const double value = parameter_point[i];
+		k.append(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+	return entries_[k];
+}
+
+int LinearizationCache::size() const {
+	return entries_.size();
+}
+
+} // end namespace ibex
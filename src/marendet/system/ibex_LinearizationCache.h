@@ -0,0 +1,103 @@
+/* ============================================================================
+ * I B E X - ibex_LinearizationCache.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_LINEARIZATIONCACHE_H__
+#define __SIP_IBEX_LINEARIZATIONCACHE_H__
+
+#include "ibex_Interval.h"
+#include "ibex_IntervalVector.h"
+#include "ibex_Vector.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \brief Gradients and corner values computed by the linearizations of a node.
+ *
+ * The cache holds the evaluations done on one box: the interval gradient of
+ * each constraint (at a parameter point, for a SIC) and its values at the
+ * corners of the box. It is emptied as soon as it is used with another box,
+ * so that linearizing a node again costs no evaluation until it is contracted.
+ *
+ * Constraints are numbered as in CutPool: first the NLCs, then the SICs.
+ */
+class LinearizationCache {
+public:
+	/**
+	 * \brief Maximal number of corner values kept per entry: 4.
+	 */
+	static const int max_corners;
+
+	/**
+	 * \brief Evaluations of a constraint (at a parameter point) on the box.
+	 */
+	struct Entry {
+		Entry();
+
+		/** \brief Return the cached value at \a corner, nullptr if none. */
+		const Interval* value(const Vector& corner) const;
+
+		/** \brief Cache the value at \a corner, replacing the oldest one if full. */
+		void set_value(const Vector& corner, const Interval& value);
+
+		bool has_gradient;
+		IntervalVector gradient;
+		std::vector<Vector> corners;
+		std::vector<Interval> values;
+	};
+
+	LinearizationCache();
+
+	/**
+	 * \brief Use the cache on \a box: it is emptied if \a box is not the cached box.
+	 */
+	void set_box(const IntervalVector& box);
+
+	/**
+	 * \brief Empty the cache.
+	 */
+	void clear();
+
+	/**
+	 * \brief Corner choice (0: lower bound, 1: upper bound of each variable) drawn
+	 * for the box, empty if none.
+	 *
+	 * Linearizers with a random corner policy keep the same corner for a box,
+	 * so that their corner values can be reused.
+	 */
+	std::vector<int> alpha;
+
+	/**
+	 * \brief Evaluations of the NLC number \a constraint.
+	 */
+	Entry& entry(int constraint);
+
+	/**
+	 * \brief Evaluations of the SIC number \a constraint at \a parameter_point.
+	 */
+	Entry& entry(int constraint, const Vector& parameter_point);
+
+	/**
+	 * \brief Number of entries.
+	 */
+	int size() const;
+
+private:
+	bool valid_;
+	IntervalVector box_;
+	std::unordered_map<std::string, Entry> entries_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_LINEARIZATIONCACHE_H__
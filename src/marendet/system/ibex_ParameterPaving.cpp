@@ -0,0 +1,417 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterPaving.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ParameterPaving.h"
+
+#include "ibex_BinarySerializer.h"
+
+#include "ibex_Exception.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <utility>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+const int initial_capacity = 4;
+
+// Ancestors are compacted when there are more than this factor times the number of rows
+const int max_ancestors_per_row = 2;
+
+long new_ancestor_table_id() {
+	static std::atomic<long> last_id(0);
+	return ++last_id;
+}
+}
+
+ParameterPaving::AncestorTable::AncestorTable() :
+		id(new_ancestor_table_id()) {
+}
+
+ParameterPaving::AncestorTable::AncestorTable(const AncestorTable& other) :
+		bounds(other.bounds), parents(other.parents), id(new_ancestor_table_id()) {
+}
+
+ParameterPaving::ParameterPaving(int parameter_dim) :
+		parameter_dim_(parameter_dim), gradient_dim_(0), size_(0), capacity_(initial_capacity),
+		arena_(std::make_shared<vector<double>>(nb_columns() * initial_capacity)),
+		ancestors_(std::make_shared<AncestorTable>()) {
+}
+
+void ParameterPaving::clear() {
+	size_ = 0;
+	ancestors_ = std::make_shared<AncestorTable>();
+}
+
+void ParameterPaving::truncate(int size) {
+	if (size < size_) {
+		size_ = size;
+	}
+}
+
+void ParameterPaving::reserve(int capacity) {
+	if (capacity <= capacity_) {
+		return;
+	}
+	// The new arena is private, whether the old one was shared or not
+	const int columns = nb_columns();
+	auto new_arena = std::make_shared<vector<double>>(columns * capacity);
+	for (int col = 0; col < columns; ++col) {
+		copy(arena_->begin() + col * capacity_, arena_->begin() + col * capacity_ + size_,
+				new_arena->begin() + col * capacity);
+	}
+	arena_ = new_arena;
+	capacity_ = capacity;
+}
+
+void ParameterPaving::grow() {
+	if (size_ == capacity_) {
+		reserve(2 * capacity_);
+	} else {
+		// The rows beyond size_ may be used by another paving sharing the arena
+		detach();
+	}
+}
+
+void ParameterPaving::resize_gradient(int gradient_dim) {
+	if (gradient_dim <= gradient_dim_) {
+		return;
+	}
+	detach();
+	const int old_gradient_dim = gradient_dim_;
+	gradient_dim_ = gradient_dim;
+	arena_->resize(nb_columns() * capacity_);
+	// Gradient columns are the last ones: the existing columns are untouched
+	for (int k = old_gradient_dim; k < gradient_dim_; ++k) {
+		fill_n(arena_->begin() + grad_lb_col(k) * capacity_, capacity_, NEG_INFINITY);
+		fill_n(arena_->begin() + grad_ub_col(k) * capacity_, capacity_, POS_INFINITY);
+	}
+}
+
+void ParameterPaving::prepare_concurrent_writes(int gradient_dim) {
+	detach();
+	resize_gradient(gradient_dim);
+}
+
+std::size_t ParameterPaving::memory_footprint() const {
+	return arena_->capacity() * sizeof(double) + ancestors_->bounds.capacity() * sizeof(double)
+			+ ancestors_->parents.capacity() * sizeof(int);
+}
+
+void ParameterPaving::serialize(BinaryWriter& writer) const {
+	writer.write_long(parameter_dim_);
+	writer.write_long(gradient_dim_);
+	writer.write_long(size_);
+	// Only the first size_ entries of each column
+	const int columns = nb_columns();
+	for (int col = 0; col < columns; ++col) {
+		writer.write_bytes(&(*arena_)[col * capacity_], size_ * sizeof(double));
+	}
+	writer.write_long(ancestor_count());
+	writer.write_bytes(ancestors_->bounds.data(), ancestors_->bounds.size() * sizeof(double));
+	writer.write_bytes(ancestors_->parents.data(), ancestors_->parents.size() * sizeof(int));
+}
+
+void ParameterPaving::deserialize(BinaryReader& reader) {
+	if (reader.read_long() != parameter_dim_) {
+		ibex_error("ParameterPaving: the serialized paving has another parameter dimension");
+	}
+	const long gradient_dim = reader.read_long();
+	const long size = reader.read_long();
+	if (gradient_dim < 0 || size < 0) {
+		ibex_error("ParameterPaving: invalid serialized paving");
+	}
+	gradient_dim_ = gradient_dim;
+	size_ = size;
+	capacity_ = std::max(size_, initial_capacity);
+	const int columns = nb_columns();
+	arena_ = std::make_shared<vector<double>>(columns * capacity_);
+	for (int col = 0; col < columns; ++col) {
+		reader.read_bytes(&(*arena_)[col * capacity_], size_ * sizeof(double));
+	}
+	const long count = reader.read_long();
+	if (count < 0) {
+		ibex_error("ParameterPaving: invalid serialized paving");
+	}
+	ancestors_ = std::make_shared<AncestorTable>();
+	ancestors_->bounds.resize(2 * count * parameter_dim_);
+	ancestors_->parents.resize(count);
+	reader.read_bytes(ancestors_->bounds.data(), ancestors_->bounds.size() * sizeof(double));
+	reader.read_bytes(ancestors_->parents.data(), ancestors_->parents.size() * sizeof(int));
+}
+
+void ParameterPaving::reset_values(int i) {
+	detach();
+	set_evaluation(i, Interval::empty_set());
+	for (int k = 0; k < gradient_dim_; ++k) {
+		at(grad_lb_col(k), i) = NEG_INFINITY;
+		at(grad_ub_col(k), i) = POS_INFINITY;
+	}
+}
+
+int ParameterPaving::push_back(const IntervalVector& parameter_box) {
+	grow();
+	const int i = size_++;
+	set_parameter_box(i, parameter_box);
+	at(parent_col(), i) = -1;
+	reset_values(i);
+	return i;
+}
+
+int ParameterPaving::push_back(const ParameterEvaluationsCache& cell) {
+	grow();
+	const int i = size_++;
+	set(i, cell);
+	at(parent_col(), i) = -1;
+	return i;
+}
+
+ParameterEvaluationsCache ParameterPaving::operator[](int i) const {
+	return ParameterEvaluationsCache(parameter_box(i), evaluation(i), full_gradient(i));
+}
+
+void ParameterPaving::set(int i, const ParameterEvaluationsCache& cell) {
+	detach();
+	set_parameter_box(i, cell.parameter_box);
+	set_evaluation(i, cell.evaluation);
+	// A gradient of size 1 is the "not computed" placeholder of ParameterEvaluationsCache
+	if (cell.full_gradient.size() > 1) {
+		set_full_gradient(i, cell.full_gradient);
+	} else {
+		for (int k = 0; k < gradient_dim_; ++k) {
+			at(grad_lb_col(k), i) = NEG_INFINITY;
+			at(grad_ub_col(k), i) = POS_INFINITY;
+		}
+	}
+}
+
+void ParameterPaving::erase(int i) {
+	for (int j = i + 1; j < size_; ++j) {
+		copy_row(j, j - 1);
+	}
+	--size_;
+}
+
+void ParameterPaving::copy_row(int from, int to) {
+	if (from == to) {
+		return;
+	}
+	detach();
+	const int columns = nb_columns();
+	for (int col = 0; col < columns; ++col) {
+		at(col, to) = at(col, from);
+	}
+}
+
+void ParameterPaving::swap_rows(int i, int j) {
+	if (i == j) {
+		return;
+	}
+	detach();
+	const int columns = nb_columns();
+	for (int col = 0; col < columns; ++col) {
+		std::swap(at(col, i), at(col, j));
+	}
+}
+
+void ParameterPaving::sort_by_evaluation_ub() {
+	detach();
+	vector<int> order(size_);
+	iota(order.begin(), order.end(), 0);
+	const double* ub = evaluation_ub();
+	// Empty evaluations are stored with ub=-oo and go at the end
+	stable_sort(order.begin(), order.end(), [ub](int i, int j) {
+		return ub[i] > ub[j];
+	});
+	const int columns = nb_columns();
+	vector<double> column(size_);
+	for (int col = 0; col < columns; ++col) {
+		for (int i = 0; i < size_; ++i) {
+			column[i] = at(col, order[i]);
+		}
+		copy(column.begin(), column.end(), arena_->begin() + col * capacity_);
+	}
+}
+
+void ParameterPaving::move_to_front(int i) {
+	if (i == 0) {
+		return;
+	}
+	detach();
+	const int columns = nb_columns();
+	for (int col = 0; col < columns; ++col) {
+		auto column = arena_->begin() + col * capacity_;
+		rotate(column, column + i, column + i + 1);
+	}
+}
+
+int ParameterPaving::bisect(int i, int dim) {
+	push_ancestor(i);
+	return split(i, dim);
+}
+
+int ParameterPaving::split(int i, int dim) {
+	grow();
+	const int j = size_++;
+	copy_row(i, j);
+	pair<Interval, Interval> halves = parameter(i, dim).bisect();
+	set_parameter(i, dim, halves.first);
+	set_parameter(j, dim, halves.second);
+	reset_values(i);
+	reset_values(j);
+	return j;
+}
+
+void ParameterPaving::bisect_all_dims(int i) {
+	if (!is_bisectable(i)) {
+		return;
+	}
+	push_ancestor(i);
+	vector<int> rows(1, i);
+	for (int dim = 0; dim < parameter_dim_; ++dim) {
+		const int rows_size = rows.size();
+		for (int r = 0; r < rows_size; ++r) {
+			const Interval param = parameter(rows[r], dim);
+			if (param.is_bisectable() && param.diam() > 1e-10) {
+				rows.push_back(split(rows[r], dim));
+			}
+		}
+	}
+}
+
+void ParameterPaving::push_ancestor(int i) {
+	if (ancestor_count() > max_ancestors_per_row * size_) {
+		compact_ancestors();
+	}
+	if (ancestors_.use_count() > 1) {
+		ancestors_ = std::make_shared<AncestorTable>(*ancestors_);
+	} else {
+		// See detach()
+		std::atomic_thread_fence(std::memory_order_acquire);
+	}
+	for (int dim = 0; dim < parameter_dim_; ++dim) {
+		ancestors_->bounds.push_back(at(param_lb_col(dim), i));
+		ancestors_->bounds.push_back(at(param_ub_col(dim), i));
+	}
+	ancestors_->parents.push_back(parent(i));
+	detach();
+	at(parent_col(), i) = ancestor_count() - 1;
+}
+
+void ParameterPaving::compact_ancestors() {
+	const int count = ancestor_count();
+	vector<int> new_index(count, -1);
+	for (int i = 0; i < size_; ++i) {
+		for (int a = parent(i); a >= 0 && new_index[a] < 0; a = ancestor_parent(a)) {
+			new_index[a] = 0;
+		}
+	}
+	// Renumber in the same order, so that parents keep smaller indices
+	auto table = std::make_shared<AncestorTable>();
+	for (int a = 0; a < count; ++a) {
+		if (new_index[a] < 0) {
+			continue;
+		}
+		new_index[a] = table->parents.size();
+		const int old_parent = ancestor_parent(a);
+		table->parents.push_back(old_parent < 0 ? -1 : new_index[old_parent]);
+		table->bounds.insert(table->bounds.end(), ancestors_->bounds.begin() + 2 * a * parameter_dim_,
+				ancestors_->bounds.begin() + 2 * (a + 1) * parameter_dim_);
+	}
+	ancestors_ = table;
+	detach();
+	for (int i = 0; i < size_; ++i) {
+		const int a = parent(i);
+		at(parent_col(), i) = a < 0 ? -1 : new_index[a];
+	}
+}
+
+void ParameterPaving::put_ancestor_box(int a, IntervalVector& full_box, int start) const {
+	for (int dim = 0; dim < parameter_dim_; ++dim) {
+		full_box[start + dim] = ancestor_parameter(a, dim);
+	}
+}
+
+IntervalVector ParameterPaving::parameter_box(int i) const {
+	IntervalVector box(parameter_dim_);
+	for (int dim = 0; dim < parameter_dim_; ++dim) {
+		box[dim] = parameter(i, dim);
+	}
+	return box;
+}
+
+void ParameterPaving::set_parameter_box(int i, const IntervalVector& box) {
+	for (int dim = 0; dim < parameter_dim_; ++dim) {
+		set_parameter(i, dim, box[dim]);
+	}
+}
+
+Vector ParameterPaving::parameter_mid(int i) const {
+	Vector mid(parameter_dim_);
+	for (int dim = 0; dim < parameter_dim_; ++dim) {
+		mid[dim] = parameter(i, dim).mid();
+	}
+	return mid;
+}
+
+double ParameterPaving::max_diam(int i) const {
+	double diam = 0;
+	for (int dim = 0; dim < parameter_dim_; ++dim) {
+		diam = std::max(diam, parameter(i, dim).diam());
+	}
+	return diam;
+}
+
+bool ParameterPaving::is_bisectable(int i) const {
+	for (int dim = 0; dim < parameter_dim_; ++dim) {
+		if (parameter(i, dim).is_bisectable()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void ParameterPaving::put_parameter_box(int i, IntervalVector& full_box, int start) const {
+	for (int dim = 0; dim < parameter_dim_; ++dim) {
+		full_box[start + dim] = parameter(i, dim);
+	}
+}
+
+void ParameterPaving::put_parameter_mid(int i, IntervalVector& full_box, int start) const {
+	for (int dim = 0; dim < parameter_dim_; ++dim) {
+		full_box[start + dim] = parameter(i, dim).mid();
+	}
+}
+
+IntervalVector ParameterPaving::full_gradient(int i) const {
+	if (gradient_dim_ == 0) {
+		// Same placeholder as ParameterEvaluationsCache
+		return IntervalVector(1);
+	}
+	IntervalVector gradient(gradient_dim_);
+	for (int k = 0; k < gradient_dim_; ++k) {
+		gradient[k] = load(grad_lb_col(k), i);
+	}
+	return gradient;
+}
+
+void ParameterPaving::set_full_gradient(int i, const IntervalVector& gradient) {
+	detach();
+	resize_gradient(gradient.size());
+	for (int k = 0; k < gradient.size(); ++k) {
+		store(grad_lb_col(k), i, gradient[k]);
+	}
+}
+
+} // end namespace ibex
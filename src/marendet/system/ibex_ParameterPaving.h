@@ -0,0 +1,485 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterPaving.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_PARAMETERPAVING_H__
+#define __SIP_IBEX_PARAMETERPAVING_H__
+
+#include "ibex_Interval.h"
+#include "ibex_IntervalVector.h"
+#include "ibex_Vector.h"
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace ibex {
+class BinaryReader;
+class BinaryWriter;
+
+/**
+ * \brief A parameter box with its evaluation and gradient, as a standalone value.
+ *
+ * This is the "row" view of a ParameterPaving. It is used to insert boxes in a
+ * paving and to read them back when the whole row is needed.
+ */
+struct ParameterEvaluationsCache {
+	IntervalVector parameter_box;
+	Interval evaluation;
+	IntervalVector full_gradient;
+
+	ParameterEvaluationsCache(const IntervalVector& parameter_box) :
+			parameter_box(parameter_box), evaluation(Interval::empty_set()), full_gradient(
+					1) {
+	}
+	ParameterEvaluationsCache(const IntervalVector& parameter_box,
+			const Interval& eval,
+			const IntervalVector& full_gradient) :
+			parameter_box(parameter_box), evaluation(eval), full_gradient(
+					full_gradient) {
+	}
+};
+
+/**
+ * \brief ParameterPaving
+ *
+ * Structure-of-arrays store of the parameter boxes of a SIConstraintCache.
+ *
+ * All the data lives in a single arena of doubles, organized in columns of
+ * capacity() entries: lb and ub for each parameter dimension, lb and ub of the
+ * evaluation, the parent of the box (see below), then lb and ub for each
+ * component of the full gradient (x and y).
+ * Filters, bisection and evaluations sweep these columns directly, without
+ * allocating an IntervalVector per box.
+ *
+ * Empty intervals are stored as [+oo,-oo]. A gradient that has not been computed
+ * yet is stored as [-oo,+oo], which carries no monotonicity information.
+ *
+ * The rows are the leaves of a tree. When a box is bisected, it is kept as an
+ * ancestor of its children, in a separate table of boxes with their parent.
+ * Since an ancestor contains all the boxes below it, a bound of the constraint
+ * on the ancestor holds on all of them (see ParameterPavingEvaluator). The
+ * evaluation, monotonicity and Newton filters (see SICPaving) remove whole
+ * subtrees by their ancestors. Ancestors which are not above any row anymore
+ * are regularly removed.
+ *
+ * The arena is copy-on-write: copying a paving (e.g., when Cell::bisect copies
+ * the BxpNodeData of a cell) only shares the arena, which is duplicated the
+ * first time one of the copies is modified. So is the table of ancestors.
+ */
+class ParameterPaving {
+public:
+	class const_iterator;
+
+	ParameterPaving(int parameter_dim);
+
+	int size() const;
+	bool empty() const;
+	int capacity() const;
+	int parameter_dim() const;
+	int gradient_dim() const;
+
+	void clear();
+	void reserve(int capacity);
+
+	/**
+	 * \brief Remove all the boxes from index \a size.
+	 */
+	void truncate(int size);
+
+	/**
+	 * \brief Append a box (and its cached values) and return its index.
+	 */
+	int push_back(const ParameterEvaluationsCache& cell);
+	int push_back(const IntervalVector& parameter_box);
+	void emplace_back(const ParameterEvaluationsCache& cell);
+
+	/**
+	 * \brief Gather the row \a i in a ParameterEvaluationsCache.
+	 */
+	ParameterEvaluationsCache operator[](int i) const;
+
+	/**
+	 * \brief Scatter \a cell in the row \a i.
+	 */
+	void set(int i, const ParameterEvaluationsCache& cell);
+
+	/**
+	 * \brief Remove the row \a i, keeping the order of the other rows.
+	 */
+	void erase(int i);
+
+	void copy_row(int from, int to);
+	void swap_rows(int i, int j);
+
+	/**
+	 * \brief Sort the rows by decreasing upper bound of their evaluation.
+	 */
+	void sort_by_evaluation_ub();
+
+	/**
+	 * \brief Move the row \a i in first position, keeping the order of the other rows.
+	 */
+	void move_to_front(int i);
+
+	/**
+	 * \brief Split the box \a i in two halves along \a dim.
+	 *
+	 * The lower half stays in row \a i, the upper half is appended. The cached
+	 * evaluations of both halves are reset and the box \a i becomes their
+	 * ancestor. Return the index of the new row.
+	 */
+	int bisect(int i, int dim);
+
+	/**
+	 * \brief Bisect the box \a i along all its (bisectable) dimensions.
+	 *
+	 * Equivalent to bisectAllDim, the first child stays in row \a i. The box
+	 * \a i becomes the (single) ancestor of all the children.
+	 */
+	void bisect_all_dims(int i);
+
+	/**
+	 * \brief Index of the ancestor the box \a i comes from, -1 for a root box.
+	 */
+	int parent(int i) const;
+
+	int ancestor_count() const;
+	Interval ancestor_parameter(int a, int dim) const;
+
+	/**
+	 * \brief Parent of the ancestor \a a, -1 for a root box.
+	 *
+	 * The parent of an ancestor always has a smaller index.
+	 */
+	int ancestor_parent(int a) const;
+	void put_ancestor_box(int a, IntervalVector& full_box, int start) const;
+
+	/**
+	 * \brief Identifier of the table of ancestors.
+	 *
+	 * It changes when the indices of the ancestors may change (compaction,
+	 * copy-on-write, clear): while it is the same, an ancestor index always
+	 * designates the same box, and new ancestors get new indices.
+	 */
+	long ancestor_table_id() const;
+
+	/**
+	 * \brief Remove the ancestors which are not above any row.
+	 */
+	void compact_ancestors();
+
+	Interval parameter(int i, int dim) const;
+	void set_parameter(int i, int dim, const Interval& value);
+	IntervalVector parameter_box(int i) const;
+	void set_parameter_box(int i, const IntervalVector& box);
+	Vector parameter_mid(int i) const;
+	double max_diam(int i) const;
+	bool is_bisectable(int i) const;
+
+	/**
+	 * \brief Write the box \a i in \a full_box, starting at index \a start.
+	 */
+	void put_parameter_box(int i, IntervalVector& full_box, int start) const;
+	void put_parameter_mid(int i, IntervalVector& full_box, int start) const;
+
+	Interval evaluation(int i) const;
+	void set_evaluation(int i, const Interval& eval);
+
+	Interval gradient(int i, int k) const;
+	IntervalVector full_gradient(int i) const;
+	void set_full_gradient(int i, const IntervalVector& gradient);
+
+	/**
+	 * \brief Reset the cached evaluation and gradient of the box \a i.
+	 */
+	void reset_values(int i);
+
+	/**
+	 * \brief Take a private arena with room for gradients of size \a gradient_dim.
+	 *
+	 * After this call, and until the paving is copied or resized, the setters
+	 * of the existing rows (parameters, evaluation and gradient of size at most
+	 * \a gradient_dim) can be called concurrently on different rows.
+	 */
+	void prepare_concurrent_writes(int gradient_dim);
+
+	/**
+	 * \brief Bytes allocated for the rows and the ancestors.
+	 *
+	 * Storage shared with other pavings (copy-on-write) is counted in full.
+	 */
+	std::size_t memory_footprint() const;
+
+	/**
+	 * \brief Append the rows and the ancestors of the paving to \a writer.
+	 */
+	void serialize(BinaryWriter& writer) const;
+
+	/**
+	 * \brief Replace the paving by the one read from \a reader (see serialize).
+	 */
+	void deserialize(BinaryReader& reader);
+
+	/**
+	 * \brief Raw columns (capacity() entries, the first size() are valid).
+	 */
+	const double* parameter_lb(int dim) const;
+	const double* parameter_ub(int dim) const;
+	const double* evaluation_lb() const;
+	const double* evaluation_ub() const;
+	const double* gradient_lb(int k) const;
+	const double* gradient_ub(int k) const;
+
+	const_iterator begin() const;
+	const_iterator end() const;
+
+	/**
+	 * \brief Read-only iteration, yielding gathered rows.
+	 */
+	class const_iterator {
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef ParameterEvaluationsCache value_type;
+		typedef int difference_type;
+		typedef const ParameterEvaluationsCache* pointer;
+		typedef ParameterEvaluationsCache reference;
+
+		const_iterator(const ParameterPaving& paving, int index) : paving_(&paving), index_(index) { }
+		ParameterEvaluationsCache operator*() const { return (*paving_)[index_]; }
+		const_iterator& operator++() { ++index_; return *this; }
+		bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+		bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+	private:
+		const ParameterPaving* paving_;
+		int index_;
+	};
+
+private:
+	int nb_columns() const;
+	int param_lb_col(int dim) const;
+	int param_ub_col(int dim) const;
+	int eval_lb_col() const;
+	int eval_ub_col() const;
+	int parent_col() const;
+	int grad_lb_col(int k) const;
+	int grad_ub_col(int k) const;
+	double& at(int col, int i);
+	double at(int col, int i) const;
+	void store(int lb_col, int i, const Interval& value);
+	Interval load(int lb_col, int i) const;
+	void resize_gradient(int gradient_dim);
+	void grow();
+
+	/**
+	 * \brief Take a private copy of the arena if it is shared with another paving.
+	 *
+	 * Must be called by every method that writes in the arena.
+	 */
+	void detach();
+
+	/**
+	 * \brief Store the box \a i as an ancestor and make it the parent of \a i.
+	 */
+	void push_ancestor(int i);
+	int split(int i, int dim);
+
+	struct AncestorTable {
+		AncestorTable();
+		AncestorTable(const AncestorTable& other);
+
+		// 2*parameter_dim bounds per ancestor
+		std::vector<double> bounds;
+		std::vector<int> parents;
+		// A copy gets a new identifier
+		const long id;
+	};
+
+	int parameter_dim_;
+	int gradient_dim_;
+	int size_;
+	int capacity_;
+	std::shared_ptr<std::vector<double>> arena_;
+	std::shared_ptr<AncestorTable> ancestors_;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int ParameterPaving::size() const {
+	return size_;
+}
+
+inline bool ParameterPaving::empty() const {
+	return size_ == 0;
+}
+
+inline int ParameterPaving::capacity() const {
+	return capacity_;
+}
+
+inline int ParameterPaving::parameter_dim() const {
+	return parameter_dim_;
+}
+
+inline int ParameterPaving::gradient_dim() const {
+	return gradient_dim_;
+}
+
+inline int ParameterPaving::nb_columns() const {
+	return 2 * (parameter_dim_ + 1 + gradient_dim_) + 1;
+}
+
+inline int ParameterPaving::param_lb_col(int dim) const {
+	return 2 * dim;
+}
+
+inline int ParameterPaving::param_ub_col(int dim) const {
+	return 2 * dim + 1;
+}
+
+inline int ParameterPaving::eval_lb_col() const {
+	return 2 * parameter_dim_;
+}
+
+inline int ParameterPaving::eval_ub_col() const {
+	return 2 * parameter_dim_ + 1;
+}
+
+inline int ParameterPaving::parent_col() const {
+	return 2 * parameter_dim_ + 2;
+}
+
+inline int ParameterPaving::grad_lb_col(int k) const {
+	return 2 * (parameter_dim_ + 1 + k) + 1;
+}
+
+inline int ParameterPaving::grad_ub_col(int k) const {
+	return 2 * (parameter_dim_ + 1 + k) + 2;
+}
+
+inline double& ParameterPaving::at(int col, int i) {
+	return (*arena_)[col * capacity_ + i];
+}
+
+inline double ParameterPaving::at(int col, int i) const {
+	return (*arena_)[col * capacity_ + i];
+}
+
+inline void ParameterPaving::detach() {
+	if (arena_.use_count() > 1) {
+		arena_ = std::make_shared<std::vector<double>>(*arena_);
+	} else {
+		// use_count() is a relaxed load: the reads of another thread (e.g. the
+		// checkpoint writer) that dropped its reference must happen before our writes
+		std::atomic_thread_fence(std::memory_order_acquire);
+	}
+}
+
+inline void ParameterPaving::store(int lb_col, int i, const Interval& value) {
+	if (value.is_empty()) {
+		at(lb_col, i) = POS_INFINITY;
+		at(lb_col + 1, i) = NEG_INFINITY;
+	} else {
+		at(lb_col, i) = value.lb();
+		at(lb_col + 1, i) = value.ub();
+	}
+}
+
+inline Interval ParameterPaving::load(int lb_col, int i) const {
+	// Interval(+oo,-oo) is the empty set
+	return Interval(at(lb_col, i), at(lb_col + 1, i));
+}
+
+inline Interval ParameterPaving::parameter(int i, int dim) const {
+	return load(param_lb_col(dim), i);
+}
+
+inline void ParameterPaving::set_parameter(int i, int dim, const Interval& value) {
+	detach();
+	store(param_lb_col(dim), i, value);
+}
+
+inline Interval ParameterPaving::evaluation(int i) const {
+	return load(eval_lb_col(), i);
+}
+
+inline void ParameterPaving::set_evaluation(int i, const Interval& eval) {
+	detach();
+	store(eval_lb_col(), i, eval);
+}
+
+inline Interval ParameterPaving::gradient(int i, int k) const {
+	if (k >= gradient_dim_) {
+		return Interval::all_reals();
+	}
+	return load(grad_lb_col(k), i);
+}
+
+inline int ParameterPaving::parent(int i) const {
+	return (int) at(parent_col(), i);
+}
+
+inline int ParameterPaving::ancestor_count() const {
+	return ancestors_->parents.size();
+}
+
+inline Interval ParameterPaving::ancestor_parameter(int a, int dim) const {
+	return Interval(ancestors_->bounds[2 * (a * parameter_dim_ + dim)],
+			ancestors_->bounds[2 * (a * parameter_dim_ + dim) + 1]);
+}
+
+inline int ParameterPaving::ancestor_parent(int a) const {
+	return ancestors_->parents[a];
+}
+
+inline long ParameterPaving::ancestor_table_id() const {
+	return ancestors_->id;
+}
+
+inline const double* ParameterPaving::parameter_lb(int dim) const {
+	return &(*arena_)[param_lb_col(dim) * capacity_];
+}
+
+inline const double* ParameterPaving::parameter_ub(int dim) const {
+	return &(*arena_)[param_ub_col(dim) * capacity_];
+}
+
+inline const double* ParameterPaving::evaluation_lb() const {
+	return &(*arena_)[eval_lb_col() * capacity_];
+}
+
+inline const double* ParameterPaving::evaluation_ub() const {
+	return &(*arena_)[eval_ub_col() * capacity_];
+}
+
+inline const double* ParameterPaving::gradient_lb(int k) const {
+	return &(*arena_)[grad_lb_col(k) * capacity_];
+}
+
+inline const double* ParameterPaving::gradient_ub(int k) const {
+	return &(*arena_)[grad_ub_col(k) * capacity_];
+}
+
+inline void ParameterPaving::emplace_back(const ParameterEvaluationsCache& cell) {
+	push_back(cell);
+}
+
+inline ParameterPaving::const_iterator ParameterPaving::begin() const {
+	return const_iterator(*this, 0);
+}
+
+inline ParameterPaving::const_iterator ParameterPaving::end() const {
+	return const_iterator(*this, size_);
+}
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_PARAMETERPAVING_H__
@@ -0,0 +1,422 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterPavingEvaluator.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ParameterPavingEvaluator.h"
+
+#include "ibex_utils.h"
+
+#include <atomic>
+
+using namespace std;
+
+namespace ibex {
+
+AncestorBounds::AncestorBounds() :
+		box_(1), table_id_(-1) {
+	box_.set_empty();
+}
+
+AncestorBounds::AncestorBounds(const AncestorBounds& other) :
+		AncestorBounds() {
+}
+
+AncestorBounds& AncestorBounds::operator=(const AncestorBounds& other) {
+	clear();
+	return *this;
+}
+
+void AncestorBounds::clear() {
+	box_.set_empty();
+	table_id_ = -1;
+	std::vector<std::atomic<int>>().swap(states_);
+	evaluations_.clear();
+	gradients_.clear();
+}
+
+ParameterPavingEvaluator::Slot::Slot(const Function& function, const IntervalVector& full_box) :
+		function(function), full_box(full_box), full_gradient(function.nb_var()) {
+}
+
+ParameterPavingEvaluator::ParameterPavingEvaluator(const Function& function, int variable_count,
+		AncestorBounds* ancestor_bounds) :
+		function_(function), variable_count_(variable_count), depends_on_parameters_(false), box_(variable_count),
+		tape_unsupported_(false), ancestor_bounds_(ancestor_bounds != nullptr ? *ancestor_bounds : own_ancestor_bounds_) {
+	slots_.emplace_back(function_, IntervalVector(function_.nb_var()));
+	for (int j = variable_count_; j < function_.nb_var(); ++j) {
+		if (function_.used(j)) {
+			depends_on_parameters_ = true;
+			break;
+		}
+	}
+}
+
+void ParameterPavingEvaluator::set_box(const IntervalVector& box) {
+	box_ = box;
+	for (Slot& slot : slots_) {
+		slot.full_box.put(0, box);
+	}
+	if (tape_ != nullptr) {
+		tape_->set_box(box);
+	}
+}
+
+void ParameterPavingEvaluator::prepare_tape(int rows) {
+	// The compilation and the x part cost about one batch
+	if (tape_ != nullptr || tape_unsupported_ || !depends_on_parameters_ || rows < ExprTape::lane_width) {
+		return;
+	}
+	tape_.reset(new ExprTape(function_, variable_count_));
+	if (!tape_->supported()) {
+		tape_.reset();
+		tape_unsupported_ = true;
+		return;
+	}
+	tape_->set_box(box_);
+}
+
+void ParameterPavingEvaluator::eval_batches(const ParameterPaving& paving, int begin, int end, int slot,
+		bool with_gradient, const std::function<bool(int)>& skip, const RowCallback& done) {
+	Slot& s = slots_[slot];
+	if (tape_ == nullptr) {
+		for (int i = begin; i < end; ++i) {
+			if (skip(i)) {
+				continue;
+			}
+			const Interval evaluation = with_gradient ? eval_in_slot(paving, i, slot, s.full_gradient)
+					: eval_in_slot(paving, i, slot);
+			if (!done(i, evaluation, s.full_gradient)) {
+				return;
+			}
+		}
+		return;
+	}
+	if (s.lanes == nullptr) {
+		s.lanes.reset(new ExprTape::Lanes(*tape_));
+	}
+	ExprTape::Lanes& lanes = *s.lanes;
+	int rows[ExprTape::lane_width];
+	int i = begin;
+	while (i < end) {
+		int count = 0;
+		for (; i < end && count < ExprTape::lane_width; ++i) {
+			if (!skip(i)) {
+				paving.put_parameter_box(i, lanes.arg[count], variable_count_);
+				rows[count++] = i;
+			}
+		}
+		if (count == 0) {
+			return;
+		}
+		tape_->eval(lanes, count);
+		for (int l = 0; l < count; ++l) {
+			if (!done(rows[l], lanes.evaluation[l], lanes.gradient[l])) {
+				return;
+			}
+		}
+	}
+}
+
+void ParameterPavingEvaluator::prepare_slots(PavingThreadPool& pool, int slots) {
+	for (int slot = slots_.size(); slot < slots; ++slot) {
+		slots_.emplace_back(pool.replica(function_, slot), slots_[0].full_box);
+	}
+}
+
+Interval ParameterPavingEvaluator::eval(const ParameterPaving& paving, int i) {
+	return eval_in_slot(paving, i, 0);
+}
+
+Interval ParameterPavingEvaluator::eval(const ParameterPaving& paving, int i, IntervalVector& full_gradient) {
+	return eval_in_slot(paving, i, 0, full_gradient);
+}
+
+Interval ParameterPavingEvaluator::eval_in_slot(const ParameterPaving& paving, int i, int slot) {
+	Slot& s = slots_[slot];
+	paving.put_parameter_box(i, s.full_box, variable_count_);
+	return centeredFormEval(s.function, s.full_box);
+}
+
+Interval ParameterPavingEvaluator::eval_in_slot(const ParameterPaving& paving, int i, int slot,
+		IntervalVector& full_gradient) {
+	Slot& s = slots_[slot];
+	paving.put_parameter_box(i, s.full_box, variable_count_);
+	return centeredFormEval(s.function, s.full_box, full_gradient);
+}
+
+Interval ParameterPavingEvaluator::eval_all(ParameterPaving& paving, bool with_gradient, IntervalVector* x_gradient) {
+	Interval hull = Interval::empty_set();
+	if (x_gradient != nullptr) {
+		x_gradient->set_empty();
+	}
+	if (paving.empty()) {
+		return hull;
+	}
+	if (!depends_on_parameters_) {
+		// The parameter part is not read by the function: any row will do
+		IntervalVector& full_gradient = slots_[0].full_gradient;
+		const Interval evaluation = eval(paving, 0, full_gradient);
+		for (int i = 0; i < paving.size(); ++i) {
+			paving.set_evaluation(i, evaluation);
+			if (with_gradient) {
+				paving.set_full_gradient(i, full_gradient);
+			}
+		}
+		if (x_gradient != nullptr) {
+			*x_gradient = full_gradient.subvector(0, variable_count_-1);
+		}
+		return evaluation;
+	}
+	prepare_ancestors(paving, with_gradient || x_gradient != nullptr);
+	prepare_tape(paving.size());
+	PavingThreadPool& pool = PavingThreadPool::global();
+	const int slots = pool.nb_slots(paving.size());
+	prepare_slots(pool, slots);
+	paving.prepare_concurrent_writes(with_gradient ? function_.nb_var() : 0);
+	// One union per slot, merged after the sweep
+	vector<Interval> hulls(slots, Interval::empty_set());
+	vector<IntervalVector> x_gradients(x_gradient != nullptr ? slots : 0, IntervalVector::empty(variable_count_));
+	pool.parallel_for(paving.size(), [&](int begin, int end, int slot) {
+		eval_rows(paving, begin, end, slot, with_gradient, hulls[slot],
+				x_gradient != nullptr ? &x_gradients[slot] : nullptr);
+	});
+	for (int slot = 0; slot < slots; ++slot) {
+		hull |= hulls[slot];
+		if (x_gradient != nullptr) {
+			*x_gradient |= x_gradients[slot];
+		}
+	}
+	return hull;
+}
+
+void ParameterPavingEvaluator::eval_rows(ParameterPaving& paving, int begin, int end, int slot, bool with_gradient,
+		Interval& hull, IntervalVector* x_gradient) {
+	const bool need_gradient = with_gradient || x_gradient != nullptr;
+	auto store = [&](int i, const Interval& evaluation, const IntervalVector& full_gradient) {
+		if (with_gradient) {
+			paving.set_full_gradient(i, full_gradient);
+		}
+		if (x_gradient != nullptr) {
+			*x_gradient |= full_gradient.subvector(0, variable_count_-1);
+		}
+		paving.set_evaluation(i, evaluation);
+		hull |= evaluation;
+		return true;
+	};
+	auto below_satisfied_ancestor = [&](int i) {
+		const int a = satisfied_ancestor(paving, i, slot, need_gradient);
+		if (a < 0) {
+			return false;
+		}
+		// The enclosures on the ancestor are valid on its sub-boxes
+		store(i, ancestor_bounds_.evaluations_[a], need_gradient ? ancestor_bounds_.gradients_[a]
+				: slots_[slot].full_gradient);
+		return true;
+	};
+	eval_batches(paving, begin, end, slot, need_gradient, below_satisfied_ancestor, store);
+}
+
+bool ParameterPavingEvaluator::is_satisfied(ParameterPaving& paving) {
+	if (!depends_on_parameters_) {
+		return paving.empty() || eval(paving, 0).ub() <= 0;
+	}
+	// The ancestors are evaluated only for the rows reached before the first unsatisfied one
+	prepare_ancestors(paving, false);
+	prepare_tape(paving.size());
+	PavingThreadPool& pool = PavingThreadPool::global();
+	prepare_slots(pool, pool.nb_slots(paving.size()));
+	// Smallest index of a row not proved satisfied, as in a sequential sweep
+	std::atomic<int> first_unsatisfied(paving.size());
+	pool.parallel_for(paving.size(), [&](int begin, int end, int slot) {
+		auto skip = [&](int i) {
+			return i >= first_unsatisfied.load() || satisfied_ancestor(paving, i, slot) >= 0;
+		};
+		eval_batches(paving, begin, end, slot, false, skip, [&](int i, const Interval& evaluation,
+				const IntervalVector&) {
+			if (evaluation.ub() <= 0) {
+				return true;
+			}
+			int current = first_unsatisfied.load();
+			while (i < current && !first_unsatisfied.compare_exchange_weak(current, i)) {
+			}
+			return false;
+		});
+	});
+	const int i = first_unsatisfied.load();
+	if (i < paving.size()) {
+		paving.move_to_front(i);
+		return false;
+	}
+	return true;
+}
+
+void ParameterPavingEvaluator::mark_satisfied(const ParameterPaving& paving, vector<char>& satisfied,
+		const vector<char>* skipped) {
+	satisfied.assign(paving.size(), false);
+	if (paving.empty()) {
+		return;
+	}
+	if (!depends_on_parameters_) {
+		const bool all = eval(paving, 0).ub() <= 0;
+		for (int i = 0; i < paving.size(); ++i) {
+			satisfied[i] = all && (skipped == nullptr || !(*skipped)[i]);
+		}
+		return;
+	}
+	prepare_ancestors(paving, false);
+	prepare_tape(paving.size());
+	PavingThreadPool& pool = PavingThreadPool::global();
+	prepare_slots(pool, pool.nb_slots(paving.size()));
+	pool.parallel_for(paving.size(), [&](int begin, int end, int slot) {
+		auto skip = [&](int i) {
+			if (skipped != nullptr && (*skipped)[i]) {
+				return true;
+			}
+			// Rows below an ancestor on which the constraint holds are not evaluated
+			if (satisfied_ancestor(paving, i, slot) >= 0) {
+				satisfied[i] = true;
+				return true;
+			}
+			return false;
+		};
+		eval_batches(paving, begin, end, slot, false, skip, [&](int i, const Interval& evaluation,
+				const IntervalVector&) {
+			satisfied[i] = evaluation.ub() <= 0;
+			return true;
+		});
+	});
+}
+
+Interval ParameterPavingEvaluator::hull(const ParameterPaving& paving) {
+	Interval res = Interval::empty_set();
+	if (paving.empty()) {
+		return res;
+	}
+	if (!depends_on_parameters_) {
+		return eval(paving, 0);
+	}
+	prepare_tape(paving.size());
+	eval_batches(paving, 0, paving.size(), 0, false, [](int) {
+		return false;
+	}, [&](int, const Interval& evaluation, const IntervalVector&) {
+		res |= evaluation;
+		return true;
+	});
+	return res;
+}
+
+void ParameterPavingEvaluator::prepare_ancestors(const ParameterPaving& paving, bool with_gradient) {
+	const int count = paving.ancestor_count();
+	rows_below_.assign(count, 0);
+	if (!depends_on_parameters_ || count == 0) {
+		return;
+	}
+	for (int i = 0; i < paving.size(); ++i) {
+		for (int a = paving.parent(i); a >= 0; a = paving.ancestor_parent(a)) {
+			++rows_below_[a];
+		}
+	}
+	AncestorBounds& bounds = ancestor_bounds_;
+	if (bounds.table_id_ != paving.ancestor_table_id() || bounds.box_ != box_) {
+		bounds.clear();
+		bounds.box_ = box_;
+		bounds.table_id_ = paving.ancestor_table_id();
+	}
+	// Ancestors appended since the last sweep are unknown
+	const int known = bounds.states_.size();
+	if (known < count) {
+		std::vector<std::atomic<int>> states(count);
+		for (int a = 0; a < count; ++a) {
+			states[a].store(a < known ? bounds.states_[a].load() : (int) AncestorBounds::unknown);
+		}
+		bounds.states_.swap(states);
+		bounds.evaluations_.resize(count);
+	}
+	if (with_gradient && (int) bounds.gradients_.size() < count) {
+		bounds.gradients_.resize(count, IntervalVector(function_.nb_var()));
+	}
+}
+
+bool ParameterPavingEvaluator::evaluate_ancestor(const ParameterPaving& paving, int a, int slot, bool with_gradient) {
+	AncestorBounds& bounds = ancestor_bounds_;
+	int state = bounds.states_[a].load();
+	// Claim the ancestor, or its upgrade with a gradient
+	const bool upgrade = with_gradient && (state == AncestorBounds::satisfied || state == AncestorBounds::unsatisfied);
+	if ((state != AncestorBounds::unknown && !upgrade)
+			|| !bounds.states_[a].compare_exchange_strong(state, AncestorBounds::busy)) {
+		return false;
+	}
+	Slot& s = slots_[slot];
+	paving.put_ancestor_box(a, s.full_box, variable_count_);
+	Interval evaluation;
+	if (with_gradient) {
+		evaluation = centeredFormEval(s.function, s.full_box, bounds.gradients_[a]);
+	} else {
+		evaluation = centeredFormEval(s.function, s.full_box);
+	}
+	if (upgrade) {
+		// Other slots may be reading the evaluation: only the gradient is added
+		bounds.states_[a].store(state == AncestorBounds::satisfied ? AncestorBounds::satisfied_with_gradient
+				: AncestorBounds::unsatisfied_with_gradient);
+		return true;
+	}
+	bounds.evaluations_[a] = evaluation;
+	if (evaluation.ub() > 0) {
+		state = with_gradient ? AncestorBounds::unsatisfied_with_gradient : AncestorBounds::unsatisfied;
+	} else {
+		state = with_gradient ? AncestorBounds::satisfied_with_gradient : AncestorBounds::satisfied;
+	}
+	bounds.states_[a].store(state);
+	return true;
+}
+
+int ParameterPavingEvaluator::satisfied_ancestor(const ParameterPaving& paving, int i, int slot, bool with_gradient) {
+	AncestorBounds& bounds = ancestor_bounds_;
+	std::vector<int>& path = slots_[slot].path;
+	path.clear();
+	for (int a = paving.parent(i); a >= 0 && a < (int) rows_below_.size(); a = paving.ancestor_parent(a)) {
+		path.push_back(a);
+	}
+	for (auto it = path.rbegin(); it != path.rend(); ++it) {
+		const int a = *it;
+		int state = bounds.states_[a].load();
+		// Evaluating an ancestor of a single row cannot save anything
+		if (state == AncestorBounds::unknown && rows_below_[a] >= 2) {
+			evaluate_ancestor(paving, a, slot, with_gradient);
+			state = bounds.states_[a].load();
+		} else if (state == AncestorBounds::satisfied && with_gradient) {
+			evaluate_ancestor(paving, a, slot, true);
+			state = bounds.states_[a].load();
+		}
+		if (state == AncestorBounds::satisfied_with_gradient || (state == AncestorBounds::satisfied && !with_gradient)) {
+			return a;
+		}
+		// Unsatisfied, or evaluated by another slot: look below
+	}
+	return -1;
+}
+
+const IntervalVector* ParameterPavingEvaluator::ancestor_gradient(const ParameterPaving& paving, int a, int slot) {
+	AncestorBounds& bounds = ancestor_bounds_;
+	if (!depends_on_parameters_ || a >= (int) rows_below_.size() || a >= (int) bounds.gradients_.size()) {
+		return nullptr;
+	}
+	int state = bounds.states_[a].load();
+	if (state != AncestorBounds::satisfied_with_gradient && state != AncestorBounds::unsatisfied_with_gradient
+			&& state != AncestorBounds::busy && rows_below_[a] >= 2) {
+		evaluate_ancestor(paving, a, slot, true);
+		state = bounds.states_[a].load();
+	}
+	if (state == AncestorBounds::satisfied_with_gradient || state == AncestorBounds::unsatisfied_with_gradient) {
+		return &bounds.gradients_[a];
+	}
+	return nullptr;
+}
+
+} // end namespace ibex
@@ -0,0 +1,234 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterPavingEvaluator.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_PARAMETERPAVINGEVALUATOR_H__
+#define __SIP_IBEX_PARAMETERPAVINGEVALUATOR_H__
+
+#include "ibex_ExprTape.h"
+#include "ibex_ParameterPaving.h"
+#include "ibex_PavingThreadPool.h"
+
+#include "ibex_Function.h"
+#include "ibex_Interval.h"
+#include "ibex_IntervalVector.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ibex {
+/**
+ * \brief Enclosures of a SIC on the ancestors of a paving, for one box x.
+ *
+ * Filled lazily by ParameterPavingEvaluator. A copy is empty.
+ */
+class AncestorBounds {
+public:
+	AncestorBounds();
+	AncestorBounds(const AncestorBounds& other);
+	AncestorBounds& operator=(const AncestorBounds& other);
+
+	/** \brief Forget all the enclosures. */
+	void clear();
+
+private:
+	friend class ParameterPavingEvaluator;
+
+	enum State : int { unknown, busy, unsatisfied, satisfied, satisfied_with_gradient, unsatisfied_with_gradient };
+
+	IntervalVector box_;
+	long table_id_;
+	std::vector<std::atomic<int>> states_;
+	std::vector<Interval> evaluations_;
+	std::vector<IntervalVector> gradients_;
+};
+
+/**
+ * \brief ParameterPavingEvaluator
+ *
+ * Batch evaluation of a SIC function on one box x and all the parameter
+ * boxes of a paving.
+ *
+ * The x part of the argument is written once by set_box, then each row only
+ * writes its parameter part. If the function does not depend on the
+ * parameters, it is evaluated once and the result is used for all the rows.
+ * Evaluations are centered forms (see centeredFormEval).
+ *
+ * Before a row is evaluated, its ancestors (see ParameterPaving) are looked
+ * at top-down. If the constraint is satisfied on an ancestor (upper bound <= 0),
+ * it is also satisfied on all the rows below it, which are not evaluated. An
+ * ancestor is evaluated lazily, the first time a row below it is reached and
+ * only if it is above at least two rows. Its result is kept in an
+ * AncestorBounds, which stays valid as long as the box x and the table of
+ * ancestors do not change: the AncestorBounds of a SIConstraintCache is shared
+ * by all the sweeps of its paving on the same box. The gradients computed
+ * on the ancestors are kept as well, for the filters (see ancestor_gradient).
+ *
+ * eval_all, is_satisfied, mark_satisfied and hull sweep the rows in batches
+ * (see ExprTape): the subexpressions which only depend on x are evaluated
+ * once for the box, and the other ones on ExprTape::lane_width rows at a
+ * time. Pavings smaller than a batch, and functions the tape cannot
+ * compile, are evaluated row by row with the ibex Function, as are the
+ * ancestors and the rows given to eval.
+ *
+ * The sweeps are parallel with the global PavingThreadPool, if the paving
+ * is large enough. Each slot of the pool has its own copy of the function,
+ * of the argument and of the batch.
+ */
+class ParameterPavingEvaluator {
+public:
+	/**
+	 * \brief Evaluator of \a function, the \a variable_count first arguments being x.
+	 *
+	 * The enclosures on the ancestors are stored in \a ancestor_bounds if it
+	 * is not null, otherwise in the evaluator.
+	 */
+	ParameterPavingEvaluator(const Function& function, int variable_count, AncestorBounds* ancestor_bounds = nullptr);
+
+	void set_box(const IntervalVector& box);
+
+	/**
+	 * \brief Evaluation on the box x the row \a i of \a paving.
+	 */
+	Interval eval(const ParameterPaving& paving, int i);
+
+	/**
+	 * \brief Evaluation and full gradient on the box x the row \a i of \a paving.
+	 */
+	Interval eval(const ParameterPaving& paving, int i, IntervalVector& full_gradient);
+
+	/**
+	 * \brief Make the slots 1 to \a slots-1 of \a pool usable by eval_in_slot.
+	 */
+	void prepare_slots(PavingThreadPool& pool, int slots);
+
+	/**
+	 * \brief Same as eval, with the function and argument of the slot \a slot.
+	 *
+	 * Different slots can be used concurrently.
+	 */
+	Interval eval_in_slot(const ParameterPaving& paving, int i, int slot);
+	Interval eval_in_slot(const ParameterPaving& paving, int i, int slot, IntervalVector& full_gradient);
+
+	/**
+	 * \brief Evaluate all the rows and store the evaluations (and the gradients
+	 * if \a with_gradient is true) in \a paving.
+	 *
+	 * Return the union of the evaluations. If \a x_gradient is not null, it is
+	 * set to the union of the gradients w.r.t. x.
+	 */
+	Interval eval_all(ParameterPaving& paving, bool with_gradient, IntervalVector* x_gradient = nullptr);
+
+	/**
+	 * \brief True iff the upper bound of all the evaluations is nonpositive.
+	 *
+	 * Stop at the first row which is not proved satisfied, and move it in first
+	 * position so that the next checks start with it.
+	 */
+	bool is_satisfied(ParameterPaving& paving);
+
+	/**
+	 * \brief Set satisfied[i] to true iff the constraint is proved satisfied on the row i.
+	 *
+	 * The rows with skipped[i] true (if \a skipped is not null) are not looked
+	 * at. The evaluations are not stored in \a paving.
+	 */
+	void mark_satisfied(const ParameterPaving& paving, std::vector<char>& satisfied,
+			const std::vector<char>* skipped = nullptr);
+
+	/**
+	 * \brief Union of the evaluations of all the rows, not stored in \a paving.
+	 *
+	 * The ancestors are not used: each row is evaluated.
+	 */
+	Interval hull(const ParameterPaving& paving);
+
+	/**
+	 * \brief Prepare the lazy evaluation of the ancestors of the rows of \a paving.
+	 *
+	 * Nothing is evaluated here. Must be called before satisfied_ancestor, and
+	 * again when the rows of the paving change.
+	 */
+	void prepare_ancestors(const ParameterPaving& paving, bool with_gradient);
+
+	/**
+	 * \brief Index of an ancestor of the row \a i on which the constraint is satisfied,
+	 * -1 if there is none.
+	 *
+	 * The ancestors of the row not yet evaluated on the box are evaluated, in
+	 * the slot \a slot, from the root down to the first one satisfied. If
+	 * \a with_gradient is true, the gradient of the ancestor returned is
+	 * available. Can be called concurrently on different slots.
+	 */
+	int satisfied_ancestor(const ParameterPaving& paving, int i, int slot = 0, bool with_gradient = false);
+
+	/**
+	 * \brief Full gradient on the box x and the ancestor \a a, null if it is not available.
+	 *
+	 * The ancestor is evaluated (with its gradient) if it has not been yet,
+	 * unless it is above a single row or another slot is evaluating it.
+	 * prepare_ancestors must have been called with \a with_gradient true.
+	 * Can be called concurrently on different slots.
+	 */
+	const IntervalVector* ancestor_gradient(const ParameterPaving& paving, int a, int slot = 0);
+
+private:
+	struct Slot {
+		Slot(const Function& function, const IntervalVector& full_box);
+
+		const Function& function;
+		IntervalVector full_box;
+		IntervalVector full_gradient;
+		// Ancestors of the current row, bottom-up
+		std::vector<int> path;
+		// Rows of the current batch, created by the first batch of the slot
+		std::unique_ptr<ExprTape::Lanes> lanes;
+	};
+
+	// Called on the rows evaluated, in their order, with their evaluation and
+	// full gradient. The sweep stops if it returns false.
+	typedef std::function<bool(int, const Interval&, const IntervalVector&)> RowCallback;
+
+	// Compile the tape if a sweep over \a rows rows uses it
+	void prepare_tape(int rows);
+
+	// Evaluate the rows [begin, end) but the ones for which skip is true, in
+	// batches if the tape is compiled. The gradients are only computed if
+	// \a with_gradient is true or if the tape is used.
+	void eval_batches(const ParameterPaving& paving, int begin, int end, int slot, bool with_gradient,
+			const std::function<bool(int)>& skip, const RowCallback& done);
+
+	// Evaluate the ancestor a if no other slot does, return false otherwise
+	bool evaluate_ancestor(const ParameterPaving& paving, int a, int slot, bool with_gradient);
+
+	// Evaluate the rows [begin, end) in the slot \a slot, see eval_all
+	void eval_rows(ParameterPaving& paving, int begin, int end, int slot, bool with_gradient, Interval& hull,
+			IntervalVector* x_gradient);
+
+	const Function& function_;
+	const int variable_count_;
+	bool depends_on_parameters_;
+	// The slot 0 (calling thread) uses function_
+	std::vector<Slot> slots_;
+
+	IntervalVector box_;
+	// Null until a sweep is large enough, or if the function cannot be compiled
+	std::unique_ptr<ExprTape> tape_;
+	bool tape_unsupported_;
+	// The number of rows below each ancestor
+	std::vector<int> rows_below_;
+	AncestorBounds own_ancestor_bounds_;
+	AncestorBounds& ancestor_bounds_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_PARAMETERPAVINGEVALUATOR_H__
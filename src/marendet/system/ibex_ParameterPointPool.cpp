@@ -0,0 +1,176 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterPointPool.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ParameterPointPool.h"
+
+#include "ibex_Interval.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using namespace std;
+
+namespace ibex {
+
+const int ParameterPointPool::default_max_size = 1000;
+const double ParameterPointPool::default_resolution = 1e-6;
+const int ParameterPointPool::default_nb_seeds = 4;
+
+thread_local int ParameterPointPool::worker_ = 0;
+
+ParameterPointPool::ParameterPointPool(const vector<IntervalVector>& domains, int max_size) :
+		resolution(default_resolution), nb_seeds(default_nb_seeds), max_size_(max_size), nb_added_(0),
+		nb_rediscovered_(0), nb_selected_(0), frozen_(false) {
+	for (const IntervalVector& domain : domains) {
+		pools_.push_back(SICPoints { domain, { }, { } });
+	}
+}
+
+string ParameterPointPool::key(const SICPoints& pool, const Vector& point) const {
+	string res;
+	for (int k = 0; k < point.size(); ++k) {
+		const double diam = pool.domain[k].diam();
+		const double step = resolution * (diam > 0 && std::isfinite(diam) ? diam : 1.0);
+		const long cell = (long) std::floor(point[k] / step);
+		res.append(reinterpret_cast<const char*>(&cell), sizeof(cell));
+	}
+	return res;
+}
+
+double ParameterPointPool::relevance(const Point& point, const IntervalVector& box) {
+	// Largest gap between the region and the box, relative to their widths
+	double distance = 0;
+	for (int k = 0; k < box.size(); ++k) {
+		const double gap = std::max(0.0,
+				std::max(point.region[k].lb() - box[k].ub(), box[k].lb() - point.region[k].ub()));
+		if (gap > 0) {
+			const double width = box[k].diam() + point.region[k].diam();
+			distance = std::max(distance, width > 0 ? gap / width : POS_INFINITY);
+		}
+	}
+	return (1 + point.discoveries) / (1 + distance);
+}
+
+void ParameterPointPool::add(int sic, const Vector& point, double value, const IntervalVector& region) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (frozen_) {
+		rounds_[worker_].additions.push_back(Change { sic, point, value, region });
+		return;
+	}
+	add_point(sic, point, value, region);
+}
+
+void ParameterPointPool::add_point(int sic, const Vector& point, double value, const IntervalVector& region) {
+	SICPoints& pool = pools_[sic];
+	const string k = key(pool, point);
+	auto it = pool.index.find(k);
+	if (it != pool.index.end()) {
+		Point& known = pool.points[it->second];
+		known.region |= region;
+		known.value = std::max(known.value, value);
+		++known.discoveries;
+		++nb_rediscovered_;
+		return;
+	}
+	pool.index[k] = pool.points.size();
+	pool.points.push_back(Point { point, value, region, 0, 0 });
+	++nb_added_;
+	if ((int) pool.points.size() > max_size_) {
+		evict(pool);
+	}
+}
+
+void ParameterPointPool::evict(SICPoints& pool) {
+	// Keep the points found or used most often, down to 90% of the maximal size
+	std::stable_sort(pool.points.begin(), pool.points.end(), [](const Point& a, const Point& b) {
+		return a.discoveries + a.uses > b.discoveries + b.uses;
+	});
+	pool.points.erase(pool.points.begin() + (long) (0.9 * max_size_), pool.points.end());
+	pool.index.clear();
+	for (int i = 0; i < (int) pool.points.size(); ++i) {
+		pool.index[key(pool, pool.points[i].point)] = i;
+	}
+}
+
+vector<Vector> ParameterPointPool::select(int sic, const IntervalVector& box, int max_points) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	SICPoints& pool = pools_[sic];
+	vector<pair<double, int>> scores;
+	for (int i = 0; i < (int) pool.points.size(); ++i) {
+		scores.emplace_back(relevance(pool.points[i], box), i);
+	}
+	const int nb_points = std::min(max_points, (int) scores.size());
+	std::partial_sort(scores.begin(), scores.begin() + nb_points, scores.end(),
+			[](const pair<double, int>& a, const pair<double, int>& b) {
+				return a.first > b.first;
+			});
+	vector<Vector> res;
+	for (int j = 0; j < nb_points; ++j) {
+		Point& point = pool.points[scores[j].second];
+		if (frozen_) {
+			rounds_[worker_].uses.emplace_back(sic, scores[j].second);
+		} else {
+			++point.uses;
+		}
+		res.push_back(point.point);
+	}
+	nb_selected_ += nb_points;
+	return res;
+}
+
+void ParameterPointPool::freeze(int nb_workers) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	rounds_.assign(nb_workers, Round());
+	frozen_ = true;
+}
+
+void ParameterPointPool::thaw() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	frozen_ = false;
+	// The uses refer to the frozen points: they are counted before an addition can evict them
+	for (const Round& round : rounds_) {
+		for (const pair<int, int>& use : round.uses) {
+			++pools_[use.first].points[use.second].uses;
+		}
+	}
+	for (const Round& round : rounds_) {
+		for (const Change& change : round.additions) {
+			add_point(change.sic, change.point, change.value, change.region);
+		}
+	}
+	rounds_.clear();
+}
+
+void ParameterPointPool::set_worker(int worker) {
+	worker_ = worker;
+}
+
+int ParameterPointPool::size(int sic) const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return pools_[sic].points.size();
+}
+
+long ParameterPointPool::nb_added() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return nb_added_;
+}
+
+long ParameterPointPool::nb_rediscovered() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return nb_rediscovered_;
+}
+
+long ParameterPointPool::nb_selected() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return nb_selected_;
+}
+
+} // end namespace ibex
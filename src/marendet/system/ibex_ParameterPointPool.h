@@ -0,0 +1,150 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterPointPool.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_PARAMETERPOINTPOOL_H__
+#define __SIP_IBEX_PARAMETERPOINTPOOL_H__
+
+#include "ibex_IntervalVector.h"
+#include "ibex_Vector.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \brief Worst-case parameters of each SIC, shared by all the nodes of the search.
+ *
+ * The Blankenship points of a node (parameters maximizing a SIC at a point x
+ * of the node) are often the maximizers of its siblings and descendants too.
+ * The pool keeps the points found anywhere in the search, with the region of
+ * the x space where they were found: the hull of these x.
+ *
+ * Two points in the same cell of a grid of step resolution*diam(domain) are
+ * the same point. Each point counts its discoveries (it was found again) and
+ * its uses (it was selected). The relevance of a point for a box decreases
+ * with the distance from its region to the box, relative to their widths,
+ * and increases with its discoveries.
+ *
+ * The pool is protected by a mutex: it can be shared by the clones of a system.
+ * During a deterministic round (see SIPOptimizer::deterministic), the pool is
+ * frozen: the workers read the same points, and their additions and uses are
+ * applied when the round ends, in the order of the workers.
+ */
+class ParameterPointPool {
+public:
+	/** \brief Default maximal number of points per SIC: 1000. */
+	static const int default_max_size;
+
+	/** \brief Default grid step, relative to the parameter domain: 1e-6. */
+	static const double default_resolution;
+
+	/** \brief Default number of points selected for a node: 4. */
+	static const int default_nb_seeds;
+
+	/**
+	 * \brief Create an empty pool for SICs with the parameter domains \a domains.
+	 */
+	ParameterPointPool(const std::vector<IntervalVector>& domains, int max_size = default_max_size);
+
+	/**
+	 * \brief Add \a point, where the SIC number \a sic takes the value \a value at the x in \a region.
+	 */
+	void add(int sic, const Vector& point, double value, const IntervalVector& region);
+
+	/**
+	 * \brief The (at most) \a max_points points of the SIC number \a sic most relevant to \a box.
+	 */
+	std::vector<Vector> select(int sic, const IntervalVector& box, int max_points);
+
+	/**
+	 * \brief Freeze the points until thaw, for a round of \a nb_workers workers.
+	 *
+	 * The additions and uses of the worker set by set_worker are recorded
+	 * instead of being applied.
+	 */
+	void freeze(int nb_workers);
+
+	/**
+	 * \brief Apply the additions and uses recorded since freeze, worker by worker.
+	 */
+	void thaw();
+
+	/**
+	 * \brief Set the number of the worker of the calling thread, during a round.
+	 */
+	static void set_worker(int worker);
+
+	/** \brief Number of points of the SIC number \a sic. */
+	int size(int sic) const;
+
+	/** \brief Number of points added, found again, and selected. */
+	long nb_added() const;
+	long nb_rediscovered() const;
+	long nb_selected() const;
+
+	/** \brief Grid step, relative to the parameter domain. */
+	double resolution;
+
+	/** \brief Number of points selected for a node by the linearizations, contractors and ascents. */
+	int nb_seeds;
+
+private:
+	struct Point {
+		Vector point;
+		double value;
+		IntervalVector region;
+		long discoveries;
+		long uses;
+	};
+
+	struct SICPoints {
+		IntervalVector domain;
+		std::vector<Point> points;
+		std::unordered_map<std::string, int> index;
+	};
+
+	// Addition or selection by a worker during a round
+	struct Change {
+		int sic;
+		Vector point;
+		double value;
+		IntervalVector region;
+	};
+
+	struct Round {
+		std::vector<Change> additions;
+		std::vector<std::pair<int, int>> uses;
+	};
+
+	std::string key(const SICPoints& pool, const Vector& point) const;
+	void add_point(int sic, const Vector& point, double value, const IntervalVector& region);
+	static double relevance(const Point& point, const IntervalVector& box);
+	void evict(SICPoints& pool);
+
+	const int max_size_;
+	mutable std::mutex mutex_;
+	std::vector<SICPoints> pools_;
+	long nb_added_;
+	long nb_rediscovered_;
+	long nb_selected_;
+	// Changes of each worker while the pool is frozen
+	bool frozen_;
+	std::vector<Round> rounds_;
+
+	static thread_local int worker_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_PARAMETERPOINTPOOL_H__
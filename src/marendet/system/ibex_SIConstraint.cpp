@@ -15,6 +15,7 @@
 
 #include "ibex_Function.h"
 #include "ibex_SIConstraintCache.h"
+#include "ibex_ParameterPavingEvaluator.h"
 
 using namespace std;
 
@@ -34,13 +35,9 @@ SIConstraint::~SIConstraint() {
 
 Interval SIConstraint::evaluateWithoutCachedValue(const IntervalVector& box, SIConstraintCache& cache) const {
 	Interval res = Interval::zero();
-	IntervalVector full_box(function_->nb_var());
-	full_box.put(0, box);
-	const int x_dim = box.size();
-	for (auto& cache_cell : cache.parameter_caches_) {
-		full_box.put(x_dim, cache_cell.parameter_box);
-		res |= centeredFormEval(*function_, full_box);
-	}
+	ParameterPavingEvaluator evaluator(*function_, box.size());
+	evaluator.set_box(box);
+	res |= evaluator.hull(cache.parameter_caches_);
 	return res;
 }
 
@@ -57,6 +54,14 @@ Interval SIConstraint::evaluate(const IntervalVector &box,
 	return centeredFormEval(*function_, full_box);
 }
 
+Interval SIConstraint::evaluate(const IntervalVector& box,
+		const IntervalVector& parameter_box, IntervalVector& full_gradient) const {
+	IntervalVector full_box(function_->nb_var());
+	full_box.put(0, box);
+	full_box.put(variable_count_, parameter_box);
+	return centeredFormEval(*function_, full_box, full_gradient);
+}
+
 Interval SIConstraint::evaluate(const IntervalVector& box, SIConstraintCache& cache) const {
 	cache.update_cache(*function_, box);
 	return cache.eval_cache_;
@@ -85,16 +90,9 @@ bool SIConstraint::isSatisfied(const IntervalVector& box, SIConstraintCache& cac
 }
 
 bool SIConstraint::isSatisfiedWithoutCachedValues(const IntervalVector& box, SIConstraintCache& cache) const {
-	IntervalVector full_box(function_->nb_var());
-	full_box.put(0, box);
-	const int x_dim = box.size();
-	for (auto& cache_cell : cache.parameter_caches_) {
-		full_box.put(x_dim, cache_cell.parameter_box);
-		if(centeredFormEval(*function_, full_box).ub() > 0) {
-			return false;
-		}
-	}
-	return true;
+	ParameterPavingEvaluator evaluator(*function_, box.size(), &cache.ancestor_bounds_);
+	evaluator.set_box(box);
+	return evaluator.is_satisfied(cache.parameter_caches_);
 }
 
 } // end namespace ibex
@@ -45,6 +45,9 @@ public:
 	Interval evaluate(const IntervalVector &box,
 			const IntervalVector& parameter_box) const;
 	Interval evaluate(const IntervalVector& box, SIConstraintCache& cache) const;
+	// Evaluation and full gradient (x and y) on box x parameter_box, in one pass
+	Interval evaluate(const IntervalVector& box,
+			const IntervalVector& parameter_box, IntervalVector& full_gradient) const;
 	//IntervalVector gradient(const IntervalVector& box) const;
 	IntervalVector gradient(const IntervalVector& box, SIConstraintCache& cache) const;
 	IntervalVector gradient(const IntervalVector& box,
@@ -11,42 +11,130 @@
  
 #include "ibex_SIConstraintCache.h"
 
-#include "ibex_utils.h"
+#include "ibex_BinarySerializer.h"
+#include "ibex_ParameterPavingEvaluator.h"
 
+#include <algorithm>
 
 using namespace std;
 
 namespace ibex {
 
+bool SIConstraintCache::default_incremental = true;
+int SIConstraintCache::max_incremental_updates = 4;
+
 SIConstraintCache::SIConstraintCache(const IntervalVector& initial_box) :
 		must_be_updated_(true), box_cached_(IntervalVector::empty(initial_box.size())), eval_cache_(
 				Interval::empty_set()), gradient_cache_(IntervalVector::empty(initial_box.size())), initial_box_(
-				initial_box) {
-	parameter_caches_.emplace_back(ParameterEvaluationsCache(initial_box));
+				initial_box), parameter_caches_(initial_box.size()), incremental_(default_incremental),
+				nb_incremental_updates_(0) {
+	parameter_caches_.push_back(initial_box);
+}
+
+void SIConstraintCache::serialize(BinaryWriter& writer) const {
+	writer.write_long(must_be_updated_);
+	writer.write_long(incremental_);
+	writer.write_long(nb_incremental_updates_);
+	writer.write_interval_vector(box_cached_);
+	writer.write_interval(eval_cache_);
+	writer.write_interval_vector(gradient_cache_);
+	parameter_caches_.serialize(writer);
+	writer.write_long(best_blankenship_points_.size());
+	for (const Vector& point : best_blankenship_points_) {
+		writer.write_vector(point);
+	}
+}
+
+void SIConstraintCache::deserialize(BinaryReader& reader) {
+	must_be_updated_ = reader.read_long();
+	incremental_ = reader.read_long();
+	nb_incremental_updates_ = reader.read_long();
+	box_cached_ = reader.read_interval_vector();
+	eval_cache_ = reader.read_interval();
+	gradient_cache_ = reader.read_interval_vector();
+	parameter_caches_.deserialize(reader);
+	best_blankenship_points_.clear();
+	const long nb_points = reader.read_long();
+	for (long i = 0; i < nb_points; ++i) {
+		best_blankenship_points_.push_back(reader.read_vector());
+	}
 }
 
 void SIConstraintCache::update_cache(const Function &function, const IntervalVector& new_box_, bool force) {
-	if (force || must_be_updated_ || box_cached_ != new_box_) {
-		box_cached_ = new_box_;
-		must_be_updated_ = false;
-	} else {
-		return;
+	if (!force && !must_be_updated_) {
+		if (box_cached_ == new_box_) {
+			return;
+		}
+		if (incremental_ && nb_incremental_updates_ < max_incremental_updates && !box_cached_.is_empty()
+				&& new_box_.is_subset(box_cached_) && incremental_update(function, new_box_)) {
+			return;
+		}
 	}
+	box_cached_ = new_box_;
+	must_be_updated_ = false;
+	nb_incremental_updates_ = 0;
 
 	// Reinitialize cache
 	const int x_dim = new_box_.size();
-	eval_cache_ = Interval::empty_set();
 	gradient_cache_ = IntervalVector::empty(x_dim);
-	IntervalVector full_box(function.nb_var());
-
-	// Prepare IntervalVector to save instantiating a new IV for each computation
-	full_box.put(0, new_box_);
-	for (auto& cache_cell : parameter_caches_) {
-		full_box.put(x_dim, cache_cell.parameter_box);
-		cache_cell.evaluation = centeredFormEval(function, full_box);
-		cache_cell.full_gradient = function.gradient(full_box);
-		eval_cache_ |= cache_cell.evaluation;
-		gradient_cache_ |= cache_cell.full_gradient.subvector(0, x_dim-1);
+	ParameterPavingEvaluator evaluator(function, x_dim, &ancestor_bounds_);
+	evaluator.set_box(new_box_);
+	eval_cache_ = evaluator.eval_all(parameter_caches_, true, &gradient_cache_);
+	// Boxes with the largest upper bounds are the most likely to reject a point
+	parameter_caches_.sort_by_evaluation_ub();
+}
+
+bool SIConstraintCache::incremental_update(const Function& function, const IntervalVector& new_box_) {
+	const int x_dim = new_box_.size();
+	vector<int> changed_vars;
+	for (int j = 0; j < x_dim; ++j) {
+		if (new_box_[j] != box_cached_[j] && function.used(j)) {
+			changed_vars.push_back(j);
+		}
+	}
+	if (changed_vars.empty()) {
+		// Only variables the constraint does not depend on changed:
+		// the cached evaluations are still exact.
+		box_cached_ = new_box_;
+		return true;
+	}
+	// Boxes created since the last sweep (e.g. by a bisection) must be evaluated
+	for (int i = 0; i < parameter_caches_.size(); ++i) {
+		if (parameter_caches_.evaluation(i).is_empty()) {
+			return false;
+		}
+		for (int j : changed_vars) {
+			if (parameter_caches_.gradient(i, j).is_empty()) {
+				return false;
+			}
+		}
+	}
+
+	// For a point p' of the new box and c an end of the old domain of x_j,
+	// f(p') = f(p) + g*(p'_j - c) where p is p' with p_j=c, and g is in the
+	// gradient enclosure computed on the old box, which contains the new one.
+	// Each bound of the evaluation is moved with the best end of each variable.
+	eval_cache_ = Interval::empty_set();
+	for (int i = 0; i < parameter_caches_.size(); ++i) {
+		const Interval evaluation = parameter_caches_.evaluation(i);
+		double lb = evaluation.lb();
+		double ub = evaluation.ub();
+		for (int j : changed_vars) {
+			const Interval g = parameter_caches_.gradient(i, j);
+			const Interval delta_lb = g * (new_box_[j] - box_cached_[j].lb());
+			const Interval delta_ub = g * (new_box_[j] - box_cached_[j].ub());
+			lb = std::max((Interval(lb) + delta_lb).lb(), (Interval(lb) + delta_ub).lb());
+			ub = std::min((Interval(ub) + delta_lb).ub(), (Interval(ub) + delta_ub).ub());
+		}
+		// lb and ub are moved from the bounds of an enclosure of the old box,
+		// so [lb,ub] is not empty (up to the rounding)
+		const Interval new_evaluation = evaluation & Interval(std::min(lb, ub), std::max(lb, ub));
+		parameter_caches_.set_evaluation(i, new_evaluation);
+		eval_cache_ |= new_evaluation;
 	}
+	// The gradient enclosures of the old box remain valid on the new one
+	box_cached_ = new_box_;
+	++nb_incremental_updates_;
+	return true;
 }
 } // end namespace ibex
@@ -12,6 +12,9 @@
 #ifndef __SIP_IBEX_SICONSTRAINTCACHE_H__
 #define __SIP_IBEX_SICONSTRAINTCACHE_H__
 
+#include "ibex_ParameterPaving.h"
+#include "ibex_ParameterPavingEvaluator.h"
+
 #include "ibex_Function.h"
 #include "ibex_Interval.h"
 #include "ibex_IntervalVector.h"
@@ -21,27 +24,23 @@
 #include <vector>
 
 namespace ibex {
-struct ParameterEvaluationsCache {
-	IntervalVector parameter_box;
-	Interval evaluation;
-	IntervalVector full_gradient;
-
-	ParameterEvaluationsCache(const IntervalVector& parameter_box) :
-			parameter_box(parameter_box), evaluation(Interval::empty_set()), full_gradient(
-					1) {
-	}
-	ParameterEvaluationsCache(const IntervalVector& parameter_box,
-			const Interval& eval,
-			const IntervalVector& full_gradient) :
-			parameter_box(parameter_box), evaluation(eval), full_gradient(
-					full_gradient) {
-	}
-};
+class BinaryReader;
+class BinaryWriter;
 
 class SIConstraintCache {
 public:
 	SIConstraintCache(const IntervalVector& initial_box);
 	virtual ~SIConstraintCache() {}
+	/**
+	 * \brief Update the evaluations of the paving on \a new_box_.
+	 *
+	 * If \a force is false and the incremental mode is on, the sweep of the paving
+	 * is avoided when \a new_box_ is a subset of the cached box: nothing is done if
+	 * the variables which changed are not used by \a function, otherwise the cached
+	 * evaluations are tightened with the cached gradients. The paving is swept
+	 * anyway if a box has no evaluation or gradient yet, and after
+	 * max_incremental_updates updates in a row, to refresh the gradients.
+	 */
 	void update_cache(const Function& function,
 			const IntervalVector& new_box_, bool force=false);
 
@@ -53,14 +52,58 @@ public:
 	 * if for example the parameter boxes changed.
 	 **/
 	bool must_be_updated_;
+
+	/**
+	 * \brief Append the cached values, the paving and the Blankenship points to \a writer.
+	 */
+	void serialize(BinaryWriter& writer) const;
+
+	/**
+	 * \brief Replace the cache by the one read from \a reader (see serialize).
+	 *
+	 * The initial box is not serialized: it is the one of *this.
+	 */
+	void deserialize(BinaryReader& reader);
+
+	/**
+	 * \brief Incremental mode of update_cache for the new caches (true by default).
+	 */
+	static bool default_incremental;
+
+	/**
+	 * \brief Maximal number of incremental updates between two sweeps of the paving: 4 by default.
+	 *
+	 * The incremental updates use the gradients of the last sweep, which are
+	 * valid but more and more pessimistic as the box shrinks.
+	 */
+	static int max_incremental_updates;
+
 	IntervalVector box_cached_;
 	Interval eval_cache_;
 	IntervalVector gradient_cache_;
 	IntervalVector initial_box_;
-	std::vector<ParameterEvaluationsCache> parameter_caches_;
+	ParameterPaving parameter_caches_;
+
+	/**
+	 * \brief Enclosures on the ancestors of the paving, shared by the sweeps on the same box.
+	 *
+	 * Not copied with the cache.
+	 */
+	AncestorBounds ancestor_bounds_;
 
 	std::list<Vector> best_blankenship_points_;
 	//double best_blankenship_point_value_ = NEG_INFINITY;
+
+private:
+	/*
+	 * Return false, leaving the cache unchanged, if a box of the paving has
+	 * no evaluation or no gradient for a variable which changed.
+	 */
+	bool incremental_update(const Function& function, const IntervalVector& new_box_);
+
+	bool incremental_;
+	// Incremental updates since the last sweep of the paving
+	int nb_incremental_updates_;
 };
 
 } // end namespace ibex
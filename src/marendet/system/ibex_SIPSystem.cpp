@@ -11,13 +11,23 @@
  
 #include "ibex_SIPSystem.h"
 
+#include "ibex_BinarySerializer.h"
+#include "ibex_PavingThreadPool.h"
+#include "ibex_utils.h"
+
 #include "ibex_CmpOp.h"
+#include "ibex_Exception.h"
 #include "ibex_ExprCopy.h"
+#include "ibex_ExprSubNodes.h"
 #include "ibex_Interval.h"
 #include "ibex_System.h"
 #include "ibex_VarSet.h"
 #include "ibex_Id.h"
 
+#include <cmath>
+#include <queue>
+#include <utility>
+
 using namespace std;
 
 namespace ibex {
@@ -30,23 +40,57 @@ long BxpNodeData::id = next_id();
 		BxpNodeData(BxpNodeData::sip_system->getInitialNodeCaches()) {
 }*/
 
-BxpNodeData::BxpNodeData(const vector<SIConstraintCache>& caches) :
-		Bxp(id), init_box(1), sic_constraints_caches(caches), init_sic_constraints_caches(caches) {
+BxpNodeData::BxpNodeData(const shared_ptr<const vector<SIConstraintCache>>& init_caches) :
+		Bxp(id), init_box(1), sic_constraints_caches(*init_caches), init_sic_constraints_caches(init_caches) {
 }
 
 void BxpNodeData::update(const BoxEvent& event, const BoxProperties& prop) {
-	// something should be done here, at least
-	// an up-to-date flag should be set to "false".
+	// The pavings stay valid on a sub-box, the linearizations do not
+	if (event.type != BoxEvent::BISECT) {
+		linearization_cache.set_box(event.box);
+	}
 }
 
 Bxp* BxpNodeData::copy(const IntervalVector& box, const BoxProperties& prop) const {
-	return new BxpNodeData(*this);
+	BxpNodeData* data = new BxpNodeData(*this);
+	data->linearization_cache.clear();
+	return data;
+}
+
+void BxpNodeData::serialize(BinaryWriter& writer) const {
+	serialize(writer, init_box, sic_constraints_caches);
+}
+
+void BxpNodeData::serialize(BinaryWriter& writer, const IntervalVector& init_box,
+		const vector<SIConstraintCache>& caches) {
+	writer.write_interval_vector(init_box);
+	writer.write_long(caches.size());
+	for (const SIConstraintCache& cache : caches) {
+		cache.serialize(writer);
+	}
+}
+
+void BxpNodeData::deserialize(BinaryReader& reader) {
+	init_box = reader.read_interval_vector();
+	if (reader.read_long() != (long) sic_constraints_caches.size()) {
+		ibex_error("BxpNodeData: the serialized node has another number of semi-infinite constraints");
+	}
+	for (SIConstraintCache& cache : sic_constraints_caches) {
+		cache.deserialize(reader);
+	}
 }
 
-SIPSystem::SIPSystem(const string& filename, const regex& quantified_regex) :
-		ibex_system_(new System(filename.c_str())), quantified_regex_(quantified_regex) {
+SIPSystem::SIPSystem(const string& filename, const regex& quantified_regex, bool presolve) :
+		ibex_system_(new System(filename.c_str())), parameter_point_pool(nullptr), nb_fixed_parameters(0),
+		nb_separable_constraints(0), quantified_regex_(quantified_regex), presolve_(presolve),
+		ibex_system_holder_(ibex_system_) {
 	goal_function_ = copyGoal();
 	extractConstraints();
+	vector<SIConstraintCache> caches;
+	for (const IntervalVector& parameter_box : initial_parameter_boxes_) {
+		caches.emplace_back(SIConstraintCache(parameter_box));
+	}
+	initial_node_caches_ = make_shared<const vector<SIConstraintCache>>(caches);
 	if(goal_function_ != NULL) {
 		nb_var = goal_function_->nb_var();
 	} else if (sic_constraints_.size() > 0) {
@@ -63,9 +107,36 @@ SIPSystem::SIPSystem(const string& filename, const regex& quantified_regex) :
 	}
 }
 
+SIPSystem::SIPSystem(const SIPSystem& system) :
+		ibex_system_(system.ibex_system_), initial_parameter_boxes_(system.initial_parameter_boxes_),
+		goal_function_(NULL), parameter_point_pool(system.parameter_point_pool), nb_var(system.nb_var),
+		ext_nb_var(system.ext_nb_var), nb_fixed_parameters(system.nb_fixed_parameters),
+		nb_separable_constraints(system.nb_separable_constraints), quantified_regex_(system.quantified_regex_),
+		presolve_(system.presolve_), initial_node_caches_(system.initial_node_caches_),
+		ibex_system_holder_(system.ibex_system_holder_), random_engine_(system.random_engine_) {
+	if (system.goal_function_ != NULL) {
+		goal_function_ = copyFunction(*system.goal_function_);
+	}
+	// Same order as in extractConstraints, so that the SIC indices (and caches) match
+	for (const Function* function : system.constraints_functions_) {
+		Function* copy = copyFunction(*function);
+		constraints_functions_.push_back(copy);
+		for (const SIConstraint& sic : system.sic_constraints_) {
+			if (sic.function_ == function) {
+				sic_constraints_.emplace_back(SIConstraint(copy, sic.variable_count_));
+			}
+		}
+		for (const NLConstraint& nlc : system.normal_constraints_) {
+			if (nlc.function_ == function) {
+				normal_constraints_.push_back(NLConstraint(copy));
+			}
+		}
+	}
+}
+
 SIPSystem::~SIPSystem() {
-	delete ibex_system_;
 	while (!constraints_functions_.empty()) {
+		PavingThreadPool::global().forget(*constraints_functions_.back());
 		delete constraints_functions_.back();
 		constraints_functions_.pop_back();
 	}
@@ -73,6 +144,18 @@ SIPSystem::~SIPSystem() {
 		delete goal_function_;
 }
 
+SIPSystem* SIPSystem::clone() const {
+	return new SIPSystem(*this);
+}
+
+std::mt19937& SIPSystem::random_engine() const {
+	return random_engine_;
+}
+
+void SIPSystem::seed(unsigned long seed) {
+	random_engine_.seed(seed);
+}
+
 double SIPSystem::goal_ub(const IntervalVector& pt) const {
 	return goal_function_->eval(pt).ub();
 }
@@ -80,7 +163,8 @@ double SIPSystem::goal_ub(const IntervalVector& pt) const {
 bool SIPSystem::is_inner(const IntervalVector& pt, BxpNodeData& node_data) const {
 	int sic_index = 0;
 	for (const auto& sic : sic_constraints_) {
-		if (sic.evaluateWithoutCachedValue(pt, node_data.sic_constraints_caches[sic_index]).ub() > 0) {
+		// Stops at the first parameter box which is not proved satisfied
+		if (!sic.isSatisfiedWithoutCachedValues(pt, node_data.sic_constraints_caches[sic_index])) {
 			return false;
 		}
 		sic_index++;
@@ -128,27 +212,43 @@ void SIPSystem::extractConstraints() {
 		// of the function)
 		const ExprNode& copy = ExprCopy().copy(allSymbols, allCopiedSymbols,
 				ibex_system_->ctrs[i].f.expr());
+		// The constraint is g <= 0
+		const ExprNode* g = nullptr;
+		if (ibex_system_->ctrs[i].op == CmpOp::LEQ)
+			g = &copy;
+		else if (ibex_system_->ctrs[i].op == CmpOp::GEQ)
+			g = &(-copy);
+		IntervalVector initParamBox(1);
+		// Parameters of the SIC, after presolve
+		Array<const ExprSymbol> sicParamCopy;
+		if (usedParamSymbols.size() > 0) {
+			// Extract the parameter box from the global initial box of the system
+			VarSet tmpVarset(ibex_system_->ctrs[i].f, usedParamSymbols, false);
+			initParamBox = tmpVarset.param_box(ibex_system_->box);
+			if (presolve_ && g != nullptr) {
+				VarSet varVarset(ibex_system_->ctrs[i].f, varSymbols);
+				g = &presolveSIC(varCopy, varVarset.var_box(ibex_system_->box), usedParamCopy, initParamBox, *g,
+						sicParamCopy);
+			} else {
+				sicParamCopy.add(usedParamCopy);
+			}
+		}
 		Array<const ExprSymbol> allCopiedSymbolsWithObj;
 		allCopiedSymbolsWithObj.add(varCopy);
 		if (goal_function_ != NULL) {
 			allCopiedSymbolsWithObj.add(ExprSymbol::new_("goal"));
 		}
-		allCopiedSymbolsWithObj.add(usedParamCopy);
+		allCopiedSymbolsWithObj.add(sicParamCopy);
 		Function* newF = nullptr;
-		if (ibex_system_->ctrs[i].op == CmpOp::LEQ)
-			newF = new Function(allCopiedSymbolsWithObj, copy);
-		else if (ibex_system_->ctrs[i].op == CmpOp::GEQ)
-			newF = new Function(allCopiedSymbolsWithObj, -copy);
+		if (g != nullptr)
+			newF = new Function(allCopiedSymbolsWithObj, *g);
 		// Add the function to the function pool
 		constraints_functions_.push_back(newF);
 		// Create NormalConstraint or SIConstraint depending on the presence of parameters
-		if (usedParamSymbols.size() == 0) {
+		if (sicParamCopy.size() == 0) {
 			normal_constraints_.push_back(NLConstraint(newF));
 		} else {
 			VarSet sicVarset(*newF, varCopy);
-			// Extract the parameter box from the global initial box of the system
-			VarSet tmpVarset(ibex_system_->ctrs[i].f, usedParamSymbols, false);
-			IntervalVector initParamBox = tmpVarset.param_box(ibex_system_->box);
 			initial_parameter_boxes_.emplace_back(initParamBox);
 			int ext_var_dim = newF->nb_var() - initParamBox.size();
 			if (goal_function_ != NULL) {
@@ -176,6 +276,194 @@ void SIPSystem::extractConstraints() {
 	}
 }
 
+namespace {
+// Maximal number of boxes and relative precision of the maximization of a separable term
+const int max_separable_boxes = 10000;
+const double separable_precision = 1e-9;
+
+/*
+ * Append the terms of the sum expr (negated if negative) to terms.
+ */
+void collect_terms(const ExprNode& expr, bool negative, vector<pair<const ExprNode*, bool>>& terms) {
+	if (const ExprAdd* add = dynamic_cast<const ExprAdd*>(&expr)) {
+		collect_terms(add->left, negative, terms);
+		collect_terms(add->right, negative, terms);
+	} else if (const ExprSub* sub = dynamic_cast<const ExprSub*>(&expr)) {
+		collect_terms(sub->left, negative, terms);
+		collect_terms(sub->right, !negative, terms);
+	} else if (const ExprMinus* minus = dynamic_cast<const ExprMinus*>(&expr)) {
+		collect_terms(minus->expr, !negative, terms);
+	} else {
+		terms.emplace_back(&expr, negative);
+	}
+}
+
+bool uses_any(const ExprSubNodes& nodes, const Array<const ExprSymbol>& symbols) {
+	for (int i = 0; i < symbols.size(); ++i) {
+		if (nodes.found(symbols[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+const ExprNode& add_term(const ExprNode* sum, const pair<const ExprNode*, bool>& term) {
+	if (sum == nullptr) {
+		return term.second ? -*term.first : *term.first;
+	}
+	return term.second ? *sum - *term.first : *sum + *term.first;
+}
+
+/*
+ * Enclosure of the maximum of f on box, by best-first bisection.
+ */
+Interval maximum(const Function& f, const IntervalVector& box) {
+	typedef pair<double, IntervalVector> Candidate;
+	auto worse = [](const Candidate& a, const Candidate& b) {
+		return a.first < b.first;
+	};
+	priority_queue<Candidate, vector<Candidate>, decltype(worse)> candidates(worse);
+	candidates.emplace(f.eval(box).ub(), box);
+	double lower = NEG_INFINITY;
+	double upper_atomic = NEG_INFINITY;
+	for (int k = 0; k < max_separable_boxes && !candidates.empty(); ++k) {
+		const Candidate candidate = candidates.top();
+		if (candidate.first - lower <= separable_precision * (1 + std::fabs(lower))) {
+			break;
+		}
+		candidates.pop();
+		const Interval mid_value = f.eval(IntervalVector(candidate.second.mid()));
+		if (!mid_value.is_empty()) {
+			lower = std::max(lower, mid_value.lb());
+		}
+		if (!candidate.second.is_bisectable()) {
+			upper_atomic = std::max(upper_atomic, candidate.first);
+			continue;
+		}
+		const auto halves = candidate.second.bisect(candidate.second.extr_diam_index(false));
+		for (const IntervalVector* half : { &halves.first, &halves.second }) {
+			const Interval value = f.eval(*half);
+			if (!value.is_empty()) {
+				candidates.emplace(value.ub(), *half);
+			}
+		}
+	}
+	double upper = std::max(upper_atomic, candidates.empty() ? NEG_INFINITY : candidates.top().first);
+	return Interval(lower, std::max(lower, upper));
+}
+}
+
+const ExprNode& SIPSystem::presolveSIC(const Array<const ExprSymbol>& vars, const IntervalVector& var_box,
+		const Array<const ExprSymbol>& params, IntervalVector& param_box, const ExprNode& g,
+		Array<const ExprSymbol>& kept_params) {
+	const int nx = var_box.size();
+	// Interval gradient on the initial box, on a private copy of g
+	Array<const ExprSymbol> vars_copy(vars.size());
+	varcopy(vars, vars_copy);
+	Array<const ExprSymbol> params_copy(params.size());
+	varcopy(params, params_copy);
+	Array<const ExprSymbol> symbols;
+	symbols.add(vars);
+	symbols.add(params);
+	Array<const ExprSymbol> symbols_copy;
+	symbols_copy.add(vars_copy);
+	symbols_copy.add(params_copy);
+	Function analysis(symbols_copy, ExprCopy().copy(symbols, symbols_copy, g));
+	IntervalVector full_box(nx + param_box.size());
+	full_box.put(0, var_box);
+	full_box.put(nx, param_box);
+	const IntervalVector gradient = analysis.gradient(full_box);
+
+	// A scalar parameter in which g is monotone is fixed at the bound where g is the largest
+	Array<const ExprNode> old_nodes;
+	Array<const ExprNode> new_nodes;
+	for (int i = 0; i < vars.size(); ++i) {
+		old_nodes.add(vars[i]);
+		new_nodes.add(vars[i]);
+	}
+	vector<const ExprSymbol*> kept;
+	vector<int> kept_components;
+	int nb_fixed = 0;
+	int component = 0;
+	for (int j = 0; j < params.size(); ++j) {
+		const int dim = params[j].dim.size();
+		old_nodes.add(params[j]);
+		const Interval& derivative = gradient[nx + component];
+		const Interval& domain = param_box[component];
+		double worst = NEG_INFINITY;
+		if (params[j].dim.is_scalar() && !derivative.is_empty()) {
+			if (derivative.lb() >= 0) {
+				worst = domain.ub();
+			} else if (derivative.ub() <= 0) {
+				worst = domain.lb();
+			}
+		}
+		if (std::isfinite(worst)) {
+			new_nodes.add(ExprConstant::new_scalar(worst));
+			++nb_fixed;
+		} else {
+			new_nodes.add(params[j]);
+			kept.push_back(&params[j]);
+			for (int k = 0; k < dim; ++k) {
+				kept_components.push_back(component + k);
+			}
+		}
+		component += dim;
+	}
+	const ExprNode* presolved = &g;
+	if (nb_fixed > 0) {
+		presolved = &ExprCopy().copy(old_nodes, new_nodes, g);
+		if (!kept_components.empty()) {
+			IntervalVector kept_box(kept_components.size());
+			for (int k = 0; k < (int) kept_components.size(); ++k) {
+				kept_box[k] = param_box[kept_components[k]];
+			}
+			param_box = kept_box;
+		}
+		nb_fixed_parameters += nb_fixed;
+	}
+	if (kept.empty()) {
+		return *presolved;
+	}
+	const Array<const ExprSymbol> remaining(kept);
+
+	// g(x,y) = a(x) + b(y): the SIC is a(x) + max b <= 0
+	vector<pair<const ExprNode*, bool>> terms;
+	collect_terms(*presolved, false, terms);
+	const ExprNode* a = nullptr;
+	const ExprNode* b = nullptr;
+	bool separable = true;
+	for (const auto& term : terms) {
+		ExprSubNodes nodes(*term.first);
+		const bool uses_params = uses_any(nodes, remaining);
+		if (uses_params && uses_any(nodes, vars)) {
+			separable = false;
+			break;
+		}
+		if (uses_params) {
+			b = &add_term(b, term);
+		} else {
+			a = &add_term(a, term);
+		}
+	}
+	Interval max_b;
+	if (separable && b != nullptr) {
+		Array<const ExprSymbol> b_params(remaining.size());
+		varcopy(remaining, b_params);
+		Function b_function(b_params, ExprCopy().copy(remaining, b_params, *b));
+		max_b = maximum(b_function, param_box);
+	}
+	if (!separable || b == nullptr || !std::isfinite(max_b.ub())) {
+		kept_params.add(remaining);
+		return *presolved;
+	}
+	++nb_separable_constraints;
+	if (a == nullptr) {
+		return ExprConstant::new_scalar(max_b);
+	}
+	return *a + max_b;
+}
+
 /*
  * Return an ibex array containing the variable symbols of a function
  */
@@ -248,12 +536,8 @@ IntervalVector SIPSystem::extractInitialBox() const {
 	}
 }
 
-vector<SIConstraintCache> SIPSystem::getInitialNodeCaches() const {
-	vector<SIConstraintCache> caches;
-	for (const IntervalVector& parameter_box : initial_parameter_boxes_) {
-		caches.emplace_back(SIConstraintCache(parameter_box));
-	}
-	return caches;
+shared_ptr<const vector<SIConstraintCache>> SIPSystem::getInitialNodeCaches() const {
+	return initial_node_caches_;
 }
 
 /*void SIPSystem::loadBxpNodeData(BxpNodeData* node_data) {
@@ -16,24 +16,53 @@
 #include "ibex_Expr.h"
 #include "ibex_Function.h"
 #include "ibex_IntervalVector.h"
+#include "ibex_LinearizationCache.h"
 #include "ibex_NLConstraint.h"
 #include "ibex_SIConstraint.h"
 #include "ibex_SIConstraintCache.h"
 #include "ibex_Bxp.h"
 
 #include <iostream>
+#include <memory>
+#include <random>
 #include <utility>
 #include <vector>
 #include <regex>
 
 namespace ibex {
+class BinaryReader;
+class BinaryWriter;
 class BxpNodeData;
+class ParameterPointPool;
 class SIPSystem {
 
 public:
-	SIPSystem(const std::string& filename, const std::regex& quantified_regex);
+	/**
+	 * \brief Load the system of the minibex file \a filename.
+	 *
+	 * The parameters are the arguments whose name matches \a quantified_regex.
+	 * If \a presolve is true, the SICs are analysed on the initial box (see
+	 * nb_fixed_parameters and nb_separable_constraints).
+	 */
+	SIPSystem(const std::string& filename, const std::regex& quantified_regex, bool presolve = true);
 	virtual ~SIPSystem();
 
+	/**
+	 * \brief Copy of the system for another thread.
+	 *
+	 * ibex Functions evaluate in internal buffers and cannot be shared by
+	 * threads: the clone has its own compiled copies of the goal and of the
+	 * constraint functions, and its own random engine. The parsed ibex system
+	 * and the initial node caches are immutable and shared.
+	 */
+	SIPSystem* clone() const;
+
+	/** \brief Random engine of this system (clones have their own). */
+	std::mt19937& random_engine() const;
+
+	/** \brief Seed the random engine. */
+	void seed(unsigned long seed);
+
 	// Ibex system needed to parse the minibex file,
 	// and must be kept alive because it is used
 	// in the buffer
@@ -43,13 +72,21 @@ public:
 	std::vector<NLConstraint> normal_constraints_;
 	std::vector<Function*> constraints_functions_;
 	Function* goal_function_;
+	// Worst-case parameters found in the search, shared with the clones (nullptr: none)
+	ParameterPointPool* parameter_point_pool;
 	int nb_var; // nb_var without goal variable
 	int ext_nb_var; // nb_var with goal variable
+	// Presolve: parameters in which a SIC is monotone on the initial box are fixed at their worst
+	// bound, and a SIC with no parameter left becomes a NLConstraint
+	int nb_fixed_parameters;
+	// Presolve: SICs g(x,y) = a(x) + b(y) replaced by the NLConstraint a(x) + max b <= 0
+	int nb_separable_constraints;
 	double goal_ub(const IntervalVector& pt) const;
 	bool is_inner(const IntervalVector& pt, BxpNodeData& prop) const;
 	double max_constraints(const IntervalVector& pt, BxpNodeData& prop) const;
 	// Load all node data for this node: current B&B box and SIConstraintsCache
-	std::vector<SIConstraintCache> getInitialNodeCaches() const;
+	// The initial caches are immutable and shared by all the nodes
+	std::shared_ptr<const std::vector<SIConstraintCache>> getInitialNodeCaches() const;
 	//void loadBxpNodeData(BxpNodeData* BxpNodeData);
 	//void updateBxpNodeData();
 	IntervalVector extractInitialBox() const;
@@ -57,6 +94,7 @@ public:
 	//BxpNodeData* node_data_ = nullptr;
 
 private:
+	SIPSystem(const SIPSystem& system);
 
 	void extractConstraints();
 	Array<const ExprSymbol> getVarSymbols(
@@ -64,8 +102,20 @@ private:
 	Array<const ExprSymbol> getUsedParamSymbols(
 			const Function* fun);
 	Function* copyGoal();
+	/*
+	 * Presolve of the SIC g <= 0 on var_box x param_box: return the new g, add the
+	 * parameters it still uses to kept_params and restrict param_box to them.
+	 */
+	const ExprNode& presolveSIC(const Array<const ExprSymbol>& vars, const IntervalVector& var_box,
+			const Array<const ExprSymbol>& params, IntervalVector& param_box, const ExprNode& g,
+			Array<const ExprSymbol>& kept_params);
 
 	std::regex quantified_regex_;
+	bool presolve_;
+	std::shared_ptr<const std::vector<SIConstraintCache>> initial_node_caches_;
+	// Owns ibex_system_, shared with the clones
+	std::shared_ptr<System> ibex_system_holder_;
+	mutable std::mt19937 random_engine_;
 };
 
 class BxpNodeData: public Bxp {
@@ -73,14 +123,36 @@ public:
 	//static SIPSystem* sip_system;
 	static long id;
 	//BxpNodeData();
-	BxpNodeData(const std::vector<SIConstraintCache>& caches);
+	BxpNodeData(const std::shared_ptr<const std::vector<SIConstraintCache>>& init_caches);
 	virtual ~BxpNodeData() {}
 	virtual Bxp* copy(const IntervalVector& box, const BoxProperties& prop) const;
 	virtual void update(const BoxEvent& event, const BoxProperties& prop);
 	//virtual std::string to_string() const;
+
+	/**
+	 * \brief Append the caches of the node (pavings, Blankenship points) to \a writer.
+	 */
+	void serialize(BinaryWriter& writer) const;
+
+	/**
+	 * \brief Same as serialize, for a node with the box \a init_box and the caches \a caches.
+	 */
+	static void serialize(BinaryWriter& writer, const IntervalVector& init_box,
+			const std::vector<SIConstraintCache>& caches);
+
+	/**
+	 * \brief Replace the caches by the ones read from \a reader (see serialize).
+	 *
+	 * *this must have been built for the same system.
+	 */
+	void deserialize(BinaryReader& reader);
+
 	IntervalVector init_box;
+	// Copies of the node data share the parameter pavings until they are modified
 	std::vector<SIConstraintCache> sic_constraints_caches;
-	std::vector<SIConstraintCache> init_sic_constraints_caches;
+	std::shared_ptr<const std::vector<SIConstraintCache>> init_sic_constraints_caches;
+	// Evaluations of the linearizations on the current box, not copied to the children
+	LinearizationCache linearization_cache;
 };
 
 } // end namespace ibex
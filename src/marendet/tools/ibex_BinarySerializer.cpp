@@ -0,0 +1,127 @@
+/* ============================================================================
+ * I B E X - ibex_BinarySerializer.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_BinarySerializer.h"
+
+#include "ibex_Exception.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace ibex {
+
+void BinaryWriter::write_bytes(const void* bytes, size_t size) {
+	data_.append(static_cast<const char*>(bytes), size);
+}
+
+void BinaryWriter::write_long(long value) {
+	write_bytes(&value, sizeof(value));
+}
+
+void BinaryWriter::write_double(double value) {
+	write_bytes(&value, sizeof(value));
+}
+
+void BinaryWriter::write_interval(const Interval& value) {
+	if (value.is_empty()) {
+		write_double(POS_INFINITY);
+		write_double(NEG_INFINITY);
+	} else {
+		write_double(value.lb());
+		write_double(value.ub());
+	}
+}
+
+void BinaryWriter::write_interval_vector(const IntervalVector& value) {
+	write_long(value.size());
+	for (int i = 0; i < value.size(); ++i) {
+		write_interval(value[i]);
+	}
+}
+
+void BinaryWriter::write_vector(const Vector& value) {
+	write_long(value.size());
+	for (int i = 0; i < value.size(); ++i) {
+		write_double(value[i]);
+	}
+}
+
+void BinaryWriter::write_string(const string& value) {
+	write_long(value.size());
+	write_bytes(value.data(), value.size());
+}
+
+BinaryReader::BinaryReader(const string& data) :
+		data_(data), position_(0) {
+}
+
+void BinaryReader::read_bytes(void* bytes, size_t size) {
+	if (size > data_.size() - position_) {
+		ibex_error("BinaryReader: unexpected end of data");
+	}
+	memcpy(bytes, data_.data() + position_, size);
+	position_ += size;
+}
+
+long BinaryReader::read_long() {
+	long value;
+	read_bytes(&value, sizeof(value));
+	return value;
+}
+
+double BinaryReader::read_double() {
+	double value;
+	read_bytes(&value, sizeof(value));
+	return value;
+}
+
+Interval BinaryReader::read_interval() {
+	const double lb = read_double();
+	const double ub = read_double();
+	// Interval(+oo,-oo) is the empty set
+	return Interval(lb, ub);
+}
+
+IntervalVector BinaryReader::read_interval_vector() {
+	const long size = read_long();
+	if (size <= 0) {
+		ibex_error("BinaryReader: invalid vector size");
+	}
+	IntervalVector value(size);
+	for (int i = 0; i < size; ++i) {
+		value[i] = read_interval();
+	}
+	return value;
+}
+
+Vector BinaryReader::read_vector() {
+	const long size = read_long();
+	if (size <= 0) {
+		ibex_error("BinaryReader: invalid vector size");
+	}
+	Vector value(size);
+	for (int i = 0; i < size; ++i) {
+		value[i] = read_double();
+	}
+	return value;
+}
+
+string BinaryReader::read_string() {
+	const long size = read_long();
+	if (size < 0 || (size_t) size > data_.size() - position_) {
+		ibex_error("BinaryReader: unexpected end of data");
+	}
+	string value(data_, position_, size);
+	position_ += size;
+	return value;
+}
+
+} // end namespace ibex
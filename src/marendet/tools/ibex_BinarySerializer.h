@@ -0,0 +1,85 @@
+/* ============================================================================
+ * I B E X - ibex_BinarySerializer.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_BINARYSERIALIZER_H__
+#define __SIP_IBEX_BINARYSERIALIZER_H__
+
+#include "ibex_Interval.h"
+#include "ibex_IntervalVector.h"
+#include "ibex_Vector.h"
+
+#include <cstddef>
+#include <string>
+
+namespace ibex {
+
+/**
+ * \brief Compact binary encoding of the search data (see SIPCheckpoint).
+ *
+ * Values are appended to an in-memory buffer, in the byte order of the
+ * machine: the data is meant to be read back on the same architecture.
+ * Empty intervals are written as [+oo,-oo], like in ParameterPaving.
+ */
+class BinaryWriter {
+public:
+	void write_bytes(const void* bytes, std::size_t size);
+	void write_long(long value);
+	void write_double(double value);
+	void write_interval(const Interval& value);
+	void write_interval_vector(const IntervalVector& value);
+	void write_vector(const Vector& value);
+	void write_string(const std::string& value);
+
+	/** \brief Bytes written so far. */
+	std::string& data();
+
+private:
+	std::string data_;
+};
+
+/**
+ * \brief Reader of the data written by a BinaryWriter.
+ *
+ * Reading past the end of the data raises an ibex error.
+ */
+class BinaryReader {
+public:
+	/** \brief Read \a data, which must outlive *this. */
+	BinaryReader(const std::string& data);
+
+	void read_bytes(void* bytes, std::size_t size);
+	long read_long();
+	double read_double();
+	Interval read_interval();
+	IntervalVector read_interval_vector();
+	Vector read_vector();
+	std::string read_string();
+
+	/** \brief True if all the data has been read. */
+	bool at_end() const;
+
+private:
+	const std::string& data_;
+	std::size_t position_;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline std::string& BinaryWriter::data() {
+	return data_;
+}
+
+inline bool BinaryReader::at_end() const {
+	return position_ == data_.size();
+}
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_BINARYSERIALIZER_H__
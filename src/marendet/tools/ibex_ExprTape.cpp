@@ -0,0 +1,536 @@
+/* ============================================================================
+ * I B E X - ibex_ExprTape.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ExprTape.h"
+
+#include "ibex_IntervalKernel.h"
+#include "ibex_Vector.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+// Enclosure of the derivative of |x|
+Interval abs_derivative(const Interval& x) {
+	if (x.lb() > 0) {
+		return Interval::one();
+	} else if (x.ub() < 0) {
+		return -Interval::one();
+	}
+	return Interval(-1, 1);
+}
+}
+
+const int ExprTape::lane_width;
+
+ExprTape::Lanes::Lanes(const ExprTape& tape) :
+		arg(lane_width, IntervalVector(tape.nb_var_)), gradient(lane_width, IntervalVector(tape.nb_var_)),
+		values_(tape.instructions_.size() * lane_width), adjoints_(tape.instructions_.size() * lane_width),
+		points_(lane_width, IntervalVector(tape.nb_var_)) {
+}
+
+ExprTape::ExprTape(const Function& function, int variable_count) :
+		nb_var_(function.nb_var()), variable_count_(variable_count),
+		supported_(function.nb_arg() == function.nb_var() && function.expr().dim.is_scalar()), root_(-1),
+		box_(variable_count) {
+	if (supported_) {
+		// All the arguments are scalar: the argument i is the variable i
+		map<const ExprNode*, int> variables;
+		for (int i = 0; i < function.nb_arg(); ++i) {
+			variables[&function.arg(i)] = i;
+		}
+		map<const ExprNode*, int> nodes;
+		root_ = compile(function.expr(), variables, nodes);
+		supported_ = root_ >= 0;
+	}
+	if (!supported_) {
+		instructions_.clear();
+		x_only_.clear();
+		return;
+	}
+	const int size = instructions_.size();
+	for (int k = 0; k < size; ++k) {
+		program_.push_back(k);
+		if (x_only_[k]) {
+			x_program_.push_back(k);
+		} else {
+			lane_program_.push_back(k);
+		}
+	}
+	// The lanes read the x-only nodes through their gradients w.r.t. x
+	frontier_index_.assign(size, -1);
+	auto frontier = [this](int k) {
+		if (k >= 0 && x_only_[k] && frontier_index_[k] < 0) {
+			frontier_index_[k] = frontier_gradients_.size();
+			frontier_gradients_.emplace_back(variable_count_);
+		}
+	};
+	for (int k : lane_program_) {
+		frontier(instructions_[k].left);
+		frontier(instructions_[k].right);
+	}
+	frontier(root_);
+	for (std::vector<Interval>& hoisted : hoisted_) {
+		hoisted.resize(size);
+	}
+	hoist_lanes_.reset(new Lanes(*this));
+}
+
+ExprTape::~ExprTape() {
+}
+
+bool ExprTape::supported() const {
+	return supported_;
+}
+
+int ExprTape::append(Op op, int left, int right) {
+	Instruction ins;
+	ins.op = op;
+	ins.left = left;
+	ins.right = right;
+	ins.var = -1;
+	ins.expon = 0;
+	ins.value = Interval::zero();
+	instructions_.push_back(ins);
+	x_only_.push_back((left < 0 || x_only_[left]) && (right < 0 || x_only_[right]));
+	return instructions_.size() - 1;
+}
+
+int ExprTape::compile(const ExprNode& e, const map<const ExprNode*, int>& variables, map<const ExprNode*, int>& nodes) {
+	// Shared subexpressions are compiled once
+	auto it = nodes.find(&e);
+	if (it != nodes.end()) {
+		return it->second;
+	}
+	if (!e.dim.is_scalar()) {
+		return -1;
+	}
+	int node = -1;
+	if (dynamic_cast<const ExprSymbol*>(&e) != nullptr) {
+		auto var = variables.find(&e);
+		if (var == variables.end()) {
+			return -1;
+		}
+		node = append(op_symbol, -1);
+		instructions_[node].var = var->second;
+		x_only_[node] = var->second < variable_count_;
+	} else if (const ExprConstant* c = dynamic_cast<const ExprConstant*>(&e)) {
+		node = append(op_constant, -1);
+		instructions_[node].value = c->get_value();
+	} else if (const ExprBinaryOp* binary = dynamic_cast<const ExprBinaryOp*>(&e)) {
+		Op op;
+		if (dynamic_cast<const ExprAdd*>(&e) != nullptr) {
+			op = op_add;
+		} else if (dynamic_cast<const ExprSub*>(&e) != nullptr) {
+			op = op_sub;
+		} else if (dynamic_cast<const ExprMul*>(&e) != nullptr) {
+			op = op_mul;
+		} else if (dynamic_cast<const ExprDiv*>(&e) != nullptr) {
+			op = op_div;
+		} else if (dynamic_cast<const ExprMin*>(&e) != nullptr) {
+			op = op_min;
+		} else if (dynamic_cast<const ExprMax*>(&e) != nullptr) {
+			op = op_max;
+		} else {
+			return -1;
+		}
+		const int left = compile(binary->left, variables, nodes);
+		const int right = left < 0 ? -1 : compile(binary->right, variables, nodes);
+		if (right < 0) {
+			return -1;
+		}
+		node = append(op, left, right);
+	} else if (const ExprUnaryOp* unary = dynamic_cast<const ExprUnaryOp*>(&e)) {
+		Op op;
+		int expon = 0;
+		if (dynamic_cast<const ExprMinus*>(&e) != nullptr) {
+			op = op_minus;
+		} else if (dynamic_cast<const ExprSqr*>(&e) != nullptr) {
+			op = op_sqr;
+		} else if (dynamic_cast<const ExprSqrt*>(&e) != nullptr) {
+			op = op_sqrt;
+		} else if (dynamic_cast<const ExprExp*>(&e) != nullptr) {
+			op = op_exp;
+		} else if (dynamic_cast<const ExprLog*>(&e) != nullptr) {
+			op = op_log;
+		} else if (dynamic_cast<const ExprSin*>(&e) != nullptr) {
+			op = op_sin;
+		} else if (dynamic_cast<const ExprCos*>(&e) != nullptr) {
+			op = op_cos;
+		} else if (dynamic_cast<const ExprTan*>(&e) != nullptr) {
+			op = op_tan;
+		} else if (dynamic_cast<const ExprAbs*>(&e) != nullptr) {
+			op = op_abs;
+		} else if (const ExprPower* p = dynamic_cast<const ExprPower*>(&e)) {
+			op = op_power;
+			expon = p->expon;
+		} else {
+			return -1;
+		}
+		const int operand = compile(unary->expr, variables, nodes);
+		if (operand < 0) {
+			return -1;
+		}
+		node = append(op, operand);
+		instructions_[node].expon = expon;
+	} else {
+		return -1;
+	}
+	nodes[&e] = node;
+	return node;
+}
+
+void ExprTape::partials(const Instruction& ins, const Interval& a, const Interval& b, const Interval& r,
+		Interval& da, Interval& db) {
+	db = Interval::zero();
+	switch (ins.op) {
+	case op_add:
+		da = Interval::one();
+		db = Interval::one();
+		break;
+	case op_sub:
+		da = Interval::one();
+		db = -Interval::one();
+		break;
+	case op_mul:
+		da = b;
+		db = a;
+		break;
+	case op_div:
+		da = 1.0 / b;
+		db = -r / b;
+		break;
+	case op_min:
+		if (a.ub() < b.lb()) {
+			da = Interval::one();
+		} else if (b.ub() < a.lb()) {
+			da = Interval::zero();
+			db = Interval::one();
+		} else {
+			da = Interval(0, 1);
+			db = Interval(0, 1);
+		}
+		break;
+	case op_max:
+		if (a.lb() > b.ub()) {
+			da = Interval::one();
+		} else if (b.lb() > a.ub()) {
+			da = Interval::zero();
+			db = Interval::one();
+		} else {
+			da = Interval(0, 1);
+			db = Interval(0, 1);
+		}
+		break;
+	case op_minus:
+		da = -Interval::one();
+		break;
+	case op_sqr:
+		da = 2.0 * a;
+		break;
+	case op_sqrt:
+		da = 1.0 / (2.0 * r);
+		break;
+	case op_exp:
+		da = r;
+		break;
+	case op_log:
+		da = 1.0 / a;
+		break;
+	case op_sin:
+		da = cos(a);
+		break;
+	case op_cos:
+		da = -sin(a);
+		break;
+	case op_tan:
+		da = 1.0 + sqr(r);
+		break;
+	case op_abs:
+		da = abs_derivative(a);
+		break;
+	case op_power:
+		da = (ins.expon == 0) ? Interval::zero() : ins.expon * pow(a, ins.expon - 1);
+		break;
+	default:
+		da = Interval::zero();
+	}
+}
+
+void ExprTape::forward(const vector<int>& program, Lanes& lanes, int count, const vector<IntervalVector>& args,
+		const vector<Interval>* hoisted) const {
+	Interval* values = lanes.values_.data();
+	for (int k : program) {
+		const Instruction& ins = instructions_[k];
+		Interval* r = values + k * lane_width;
+		// An operand read from hoisted is the same in all the lanes: stride 0
+		const Interval* a = nullptr;
+		const Interval* b = nullptr;
+		int sa = 1;
+		int sb = 1;
+		if (ins.left >= 0) {
+			if (hoisted != nullptr && x_only_[ins.left]) {
+				a = &(*hoisted)[ins.left];
+				sa = 0;
+			} else {
+				a = values + ins.left * lane_width;
+			}
+		}
+		if (ins.right >= 0) {
+			if (hoisted != nullptr && x_only_[ins.right]) {
+				b = &(*hoisted)[ins.right];
+				sb = 0;
+			} else {
+				b = values + ins.right * lane_width;
+			}
+		}
+		switch (ins.op) {
+		case op_symbol:
+			for (int l = 0; l < count; ++l) r[l] = args[l][ins.var];
+			break;
+		case op_constant:
+			for (int l = 0; l < count; ++l) r[l] = ins.value;
+			break;
+		case op_add:
+			for (int l = 0; l < count; ++l) r[l] = a[l * sa] + b[l * sb];
+			break;
+		case op_sub:
+			for (int l = 0; l < count; ++l) r[l] = a[l * sa] - b[l * sb];
+			break;
+		case op_mul:
+			for (int l = 0; l < count; ++l) r[l] = a[l * sa] * b[l * sb];
+			break;
+		case op_div:
+			for (int l = 0; l < count; ++l) r[l] = a[l * sa] / b[l * sb];
+			break;
+		case op_min:
+			for (int l = 0; l < count; ++l) r[l] = ibex::min(a[l * sa], b[l * sb]);
+			break;
+		case op_max:
+			for (int l = 0; l < count; ++l) r[l] = ibex::max(a[l * sa], b[l * sb]);
+			break;
+		case op_minus:
+			for (int l = 0; l < count; ++l) r[l] = -a[l * sa];
+			break;
+		case op_sqr:
+			for (int l = 0; l < count; ++l) r[l] = sqr(a[l * sa]);
+			break;
+		case op_sqrt:
+			for (int l = 0; l < count; ++l) r[l] = sqrt(a[l * sa]);
+			break;
+		case op_exp:
+			for (int l = 0; l < count; ++l) r[l] = exp(a[l * sa]);
+			break;
+		case op_log:
+			for (int l = 0; l < count; ++l) r[l] = log(a[l * sa]);
+			break;
+		case op_sin:
+			for (int l = 0; l < count; ++l) r[l] = sin(a[l * sa]);
+			break;
+		case op_cos:
+			for (int l = 0; l < count; ++l) r[l] = cos(a[l * sa]);
+			break;
+		case op_tan:
+			for (int l = 0; l < count; ++l) r[l] = tan(a[l * sa]);
+			break;
+		case op_abs:
+			for (int l = 0; l < count; ++l) r[l] = ibex::abs(a[l * sa]);
+			break;
+		case op_power:
+			for (int l = 0; l < count; ++l) r[l] = ibex::pow(a[l * sa], ins.expon);
+			break;
+		}
+	}
+}
+
+const Interval& ExprTape::root_value(const Lanes& lanes, int l, const vector<Interval>* hoisted) const {
+	if (hoisted != nullptr && x_only_[root_]) {
+		return (*hoisted)[root_];
+	}
+	return lanes.values_[root_ * lane_width + l];
+}
+
+void ExprTape::set_box(const IntervalVector& box) {
+	box_ = box;
+	if (!supported_) {
+		return;
+	}
+	Lanes& lanes = *hoist_lanes_;
+	const IntervalVector ends[3] = { IntervalVector(box.mid()), IntervalVector(box.lb()), IntervalVector(box.ub()) };
+	for (int v = 0; v < 4; ++v) {
+		lanes.arg[0].put(0, v == 0 ? box : ends[v - 1]);
+		forward(x_program_, lanes, 1, lanes.arg, nullptr);
+		for (int k : x_program_) {
+			hoisted_[v][k] = lanes.values_[k * lane_width];
+		}
+	}
+
+	// Gradients of the frontier nodes, on the box
+	const vector<Interval>& values = hoisted_[0];
+	vector<Interval> adjoints(instructions_.size());
+	for (int f = 0; f < (int) instructions_.size(); ++f) {
+		if (frontier_index_[f] < 0) {
+			continue;
+		}
+		IntervalVector& gradient = frontier_gradients_[frontier_index_[f]];
+		gradient.clear();
+		for (int k : x_program_) {
+			adjoints[k] = Interval::zero();
+		}
+		adjoints[f] = Interval::one();
+		for (auto it = x_program_.rbegin(); it != x_program_.rend(); ++it) {
+			const int k = *it;
+			const Instruction& ins = instructions_[k];
+			if (k > f || adjoints[k] == Interval::zero() || ins.op == op_constant) {
+				continue;
+			}
+			if (ins.op == op_symbol) {
+				gradient[ins.var] += adjoints[k];
+				continue;
+			}
+			Interval da, db;
+			partials(ins, values[ins.left], ins.right >= 0 ? values[ins.right] : Interval::zero(), values[k], da, db);
+			adjoints[ins.left] += adjoints[k] * da;
+			if (ins.right >= 0) {
+				adjoints[ins.right] += adjoints[k] * db;
+			}
+		}
+	}
+}
+
+void ExprTape::backward(Lanes& lanes, int count) const {
+	for (int l = 0; l < count; ++l) {
+		lanes.gradient[l].clear();
+	}
+	if (x_only_[root_]) {
+		const IntervalVector& root_gradient = frontier_gradients_[frontier_index_[root_]];
+		for (int l = 0; l < count; ++l) {
+			lanes.gradient[l].put(0, root_gradient);
+		}
+		return;
+	}
+	const vector<Interval>& hoisted = hoisted_[0];
+	const Interval* values = lanes.values_.data();
+	Interval* adjoints = lanes.adjoints_.data();
+	for (int k : lane_program_) {
+		for (int l = 0; l < count; ++l) adjoints[k * lane_width + l] = Interval::zero();
+	}
+	for (int l = 0; l < count; ++l) adjoints[root_ * lane_width + l] = Interval::one();
+
+	// The adjoint of an x-only operand goes to the gradient w.r.t. x through its own gradient
+	auto propagate = [&](int j, int l, const Interval& d) {
+		if (!x_only_[j]) {
+			adjoints[j * lane_width + l] += d;
+		} else if (instructions_[j].op != op_constant) {
+			const IntervalVector& gradient = frontier_gradients_[frontier_index_[j]];
+			for (int v = 0; v < variable_count_; ++v) {
+				lanes.gradient[l][v] += d * gradient[v];
+			}
+		}
+	};
+	for (auto it = lane_program_.rbegin(); it != lane_program_.rend(); ++it) {
+		const int k = *it;
+		const Instruction& ins = instructions_[k];
+		const Interval* g = adjoints + k * lane_width;
+		if (ins.op == op_symbol) {
+			for (int l = 0; l < count; ++l) lanes.gradient[l][ins.var] += g[l];
+			continue;
+		}
+		for (int l = 0; l < count; ++l) {
+			const Interval& a = x_only_[ins.left] ? hoisted[ins.left] : values[ins.left * lane_width + l];
+			const Interval& b = (ins.right < 0) ? Interval::zero() :
+					(x_only_[ins.right] ? hoisted[ins.right] : values[ins.right * lane_width + l]);
+			Interval da, db;
+			partials(ins, a, b, values[k * lane_width + l], da, db);
+			propagate(ins.left, l, g[l] * da);
+			if (ins.right >= 0) {
+				propagate(ins.right, l, g[l] * db);
+			}
+		}
+	}
+}
+
+void ExprTape::eval(Lanes& lanes, int count) const {
+	for (int l = 0; l < count; ++l) {
+		lanes.arg[l].put(0, box_);
+	}
+	// Natural extension and gradient on the boxes
+	Interval natural[lane_width];
+	forward(lane_program_, lanes, count, lanes.arg, &hoisted_[0]);
+	for (int l = 0; l < count; ++l) {
+		natural[l] = root_value(lanes, l, &hoisted_[0]);
+	}
+	backward(lanes, count);
+
+	// Midpoints, lower and upper ends: the x part is the one of set_box
+	Interval ends[3][lane_width];
+	for (int v = 1; v < 4; ++v) {
+		for (int l = 0; l < count; ++l) {
+			const IntervalVector& arg = lanes.arg[l];
+			IntervalVector& point = lanes.points_[l];
+			for (int j = variable_count_; j < nb_var_; ++j) {
+				point[j] = (v == 1) ? arg[j].mid() : ((v == 2) ? arg[j].lb() : arg[j].ub());
+			}
+		}
+		forward(lane_program_, lanes, count, lanes.points_, &hoisted_[v]);
+		for (int l = 0; l < count; ++l) {
+			ends[v - 1][l] = root_value(lanes, l, &hoisted_[v]);
+		}
+	}
+
+	// Ends chosen by the signs of the gradient: they differ in x from a lane
+	// to another, all the instructions are run
+	Interval monotonic[2][lane_width];
+	for (int side = 0; side < 2; ++side) {
+		for (int l = 0; l < count; ++l) {
+			const IntervalVector& arg = lanes.arg[l];
+			const IntervalVector& gradient = lanes.gradient[l];
+			IntervalVector& point = lanes.points_[l];
+			for (int j = 0; j < nb_var_; ++j) {
+				if (gradient[j].lb() > 0) {
+					point[j] = (side == 0) ? arg[j].lb() : arg[j].ub();
+				} else if (gradient[j].ub() < 0) {
+					point[j] = (side == 0) ? arg[j].ub() : arg[j].lb();
+				} else {
+					point[j] = arg[j];
+				}
+			}
+		}
+		forward(program_, lanes, count, lanes.points_, nullptr);
+		for (int l = 0; l < count; ++l) {
+			monotonic[side][l] = root_value(lanes, l, nullptr);
+		}
+	}
+
+	for (int l = 0; l < count; ++l) {
+		const IntervalVector& arg = lanes.arg[l];
+		// On a point, all the forms reduce to the natural extension
+		if (arg.is_degenerated()) {
+			lanes.evaluation[l] = natural[l];
+			continue;
+		}
+		const IntervalVector& gradient = lanes.gradient[l];
+		const Vector mid = arg.mid();
+		Interval linear_terms[3];
+		if (!centered_forms_linear_terms(gradient, arg, mid, linear_terms)) {
+			// Unbounded box or gradient: use interval arithmetic
+			linear_terms[0] = gradient * (arg - mid);
+			linear_terms[1] = gradient * (arg - arg.lb());
+			linear_terms[2] = gradient * (arg - arg.ub());
+		}
+		Interval res = natural[l] & (ends[0][l] + linear_terms[0]) & (ends[1][l] + linear_terms[1])
+				& (ends[2][l] + linear_terms[2]);
+		res &= Interval(monotonic[0][l].lb(), monotonic[1][l].ub());
+		lanes.evaluation[l] = res;
+	}
+}
+
+} // end namespace ibex
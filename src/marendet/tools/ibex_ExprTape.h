@@ -0,0 +1,166 @@
+/* ============================================================================
+ * I B E X - ibex_ExprTape.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_EXPRTAPE_H__
+#define __SIP_IBEX_EXPRTAPE_H__
+
+#include "ibex_Expr.h"
+#include "ibex_Function.h"
+#include "ibex_Interval.h"
+#include "ibex_IntervalVector.h"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \brief Scalar function compiled for the evaluation of many boxes sharing their x part.
+ *
+ * The expression of the function is compiled into a list of instructions
+ * in topological order. The first \a variable_count variables are x, the
+ * other ones the parameters. The nodes which do not depend on the
+ * parameters are evaluated once by set_box, on the box x, on its midpoint
+ * and on its ends, with their gradients w.r.t. x. eval then runs the other
+ * instructions on lanes of up to lane_width boxes, each instruction on all
+ * the lanes before the next one, and returns the centered forms of
+ * centeredFormEval with the full gradients.
+ *
+ * Only scalar expressions of scalar symbols with constants, + - * /, sqr,
+ * sqrt, exp, log, sin, cos, tan, abs, integer powers, min and max are
+ * compiled. supported() is false for the other ones: the caller must
+ * evaluate the ibex Function instead.
+ *
+ * The tape is not modified by eval: several threads can use it at the same
+ * time, each one with its own Lanes.
+ */
+class ExprTape {
+public:
+	/**
+	 * \brief Maximal number of boxes evaluated together.
+	 */
+	static const int lane_width = 8;
+
+	/**
+	 * \brief Boxes of a batch, with the workspace of the evaluation.
+	 */
+	class Lanes {
+	public:
+		explicit Lanes(const ExprTape& tape);
+
+		/** \brief Arguments of the lanes: eval writes the x part, the caller the parameters. */
+		std::vector<IntervalVector> arg;
+
+		/** \brief Centered form evaluation of each lane. */
+		Interval evaluation[lane_width];
+
+		/** \brief Full gradient (x and parameters) of each lane. */
+		std::vector<IntervalVector> gradient;
+
+	private:
+		friend class ExprTape;
+
+		// Value and adjoint of the node k in the lane l: [k*lane_width + l]
+		std::vector<Interval> values_;
+		std::vector<Interval> adjoints_;
+		// Arguments of the point evaluations
+		std::vector<IntervalVector> points_;
+	};
+
+	/**
+	 * \brief Compile \a function, the \a variable_count first variables being x.
+	 */
+	ExprTape(const Function& function, int variable_count);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~ExprTape();
+
+	/**
+	 * \brief True if the expression could be compiled.
+	 */
+	bool supported() const;
+
+	/**
+	 * \brief Evaluate the nodes that only depend on x.
+	 */
+	void set_box(const IntervalVector& box);
+
+	/**
+	 * \brief Centered forms and gradients of the lanes [0, count) on the box of set_box.
+	 */
+	void eval(Lanes& lanes, int count) const;
+
+private:
+	enum Op : int {
+		op_symbol, op_constant, op_add, op_sub, op_mul, op_div, op_min, op_max, op_minus, op_sqr, op_sqrt, op_exp,
+		op_log, op_sin, op_cos, op_tan, op_abs, op_power
+	};
+
+	struct Instruction {
+		Op op;
+		// Operands (-1 if none)
+		int left;
+		int right;
+		// Variable of a symbol
+		int var;
+		// Exponent of a power
+		int expon;
+		Interval value;
+	};
+
+	// Append the instructions of e (and of its operands), return its node, -1 if not supported
+	int compile(const ExprNode& e, const std::map<const ExprNode*, int>& variables,
+			std::map<const ExprNode*, int>& nodes);
+	int append(Op op, int left, int right = -1);
+
+	// Derivatives of the instruction w.r.t. its operands of values a and b, r being its value
+	static void partials(const Instruction& ins, const Interval& a, const Interval& b, const Interval& r,
+			Interval& da, Interval& db);
+
+	// Run the instructions of program on the lanes. The operands which only
+	// depend on x are read from hoisted (the same in all the lanes), if not null.
+	void forward(const std::vector<int>& program, Lanes& lanes, int count, const std::vector<IntervalVector>& args,
+			const std::vector<Interval>* hoisted) const;
+
+	// Gradients of the lanes, after the forward sweep on the box
+	void backward(Lanes& lanes, int count) const;
+
+	// Value of the root in the lane l after a forward sweep
+	const Interval& root_value(const Lanes& lanes, int l, const std::vector<Interval>* hoisted) const;
+
+	const int nb_var_;
+	const int variable_count_;
+	bool supported_;
+
+	std::vector<Instruction> instructions_;
+	// True for the nodes that do not depend on the parameters
+	std::vector<char> x_only_;
+	int root_;
+	// Instructions depending on x only, the other ones, all of them
+	std::vector<int> x_program_;
+	std::vector<int> lane_program_;
+	std::vector<int> program_;
+
+	IntervalVector box_;
+	// Values of the x-only nodes on the box, the midpoint, the lower and the upper ends of x
+	std::vector<Interval> hoisted_[4];
+	// Gradients w.r.t. x of the x-only nodes used by the other ones (or of
+	// the root), and their index in frontier_gradients_ (-1 for the other nodes)
+	std::vector<IntervalVector> frontier_gradients_;
+	std::vector<int> frontier_index_;
+	std::unique_ptr<Lanes> hoist_lanes_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_EXPRTAPE_H__
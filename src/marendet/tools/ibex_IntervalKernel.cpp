@@ -0,0 +1,178 @@
+/* ============================================================================
+ * I B E X - ibex_IntervalKernel.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_IntervalKernel.h"
+
+#include <cfenv>
+#include <cmath>
+#include <vector>
+
+// The kernel relies on the rounding mode: it must not be folded or
+// reordered by the compiler as if rounding was to nearest. This is
+// guaranteed by the optimize attribute of GCC, or by -frounding-math on
+// the command line (SIP_ROUNDING_MATH, see wscript). Otherwise the kernel
+// is not used and the callers fall back to interval arithmetic.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define SIP_KERNEL_ATTRIBUTES __attribute__((target_clones("avx512f","avx2","default"), optimize("rounding-math")))
+#define SIP_KERNEL_ROUNDING 1
+#elif defined(__GNUC__) && !defined(__clang__)
+#define SIP_KERNEL_ATTRIBUTES __attribute__((optimize("rounding-math")))
+#define SIP_KERNEL_ROUNDING 1
+#elif defined(SIP_ROUNDING_MATH)
+#define SIP_KERNEL_ATTRIBUTES
+#define SIP_KERNEL_ROUNDING 1
+#else
+#define SIP_KERNEL_ATTRIBUTES
+#define SIP_KERNEL_ROUNDING 0
+#endif
+
+// std::max is not inlined in a function with its own optimization options
+#define SIP_KERNEL_MAX(x, y) ((x) > (y) ? (x) : (y))
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// Number of independent accumulators: a multiple of the widest vector (8 doubles)
+const int LANES = 8;
+
+/*
+ * Must be called with the rounding mode set upward.
+ *
+ * For a center c, d=arg-c is enclosed by [-(c-arg_lb), arg_ub-c] and
+ *   ub(g*d) = max(a*dl, a*du, b*dl, b*du)
+ *   -lb(g*d) = max(-a*dl, -a*du, -b*dl, -b*du)
+ * with g=[a,b]. For c=lb, d is in [0,w] and for c=ub, d is in [-w,0], with
+ * w=arg_ub-arg_lb, so that -lb(lb form)=ub(ub form)=max(0,-a*w) and
+ * ub(lb form)=-lb(ub form)=max(0,b*w).
+ * Lower bounds are accumulated negated so that all the sums round upward.
+ * The sums are split in LANES independent accumulators, which makes the
+ * loop vectorizable without reassociating a single sum.
+ */
+SIP_KERNEL_ATTRIBUTES
+void linear_terms_upward(int n, const double* grad_lb, const double* grad_ub,
+		const double* arg_lb, const double* arg_ub, const double* mid, double* neg_lb, double* ub) {
+	double neg_lb_mid[LANES] = { 0 };
+	double ub_mid[LANES] = { 0 };
+	double neg_lb_end[LANES] = { 0 };
+	double ub_end[LANES] = { 0 };
+	int i = 0;
+	for (; i + LANES <= n; i += LANES) {
+		for (int l = 0; l < LANES; ++l) {
+			const double a = grad_lb[i + l];
+			const double b = grad_ub[i + l];
+			const double dl = -(mid[i + l] - arg_lb[i + l]);
+			const double du = arg_ub[i + l] - mid[i + l];
+			const double w = arg_ub[i + l] - arg_lb[i + l];
+			ub_mid[l] += SIP_KERNEL_MAX(SIP_KERNEL_MAX(a * dl, a * du), SIP_KERNEL_MAX(b * dl, b * du));
+			neg_lb_mid[l] += SIP_KERNEL_MAX(SIP_KERNEL_MAX(-a * dl, -a * du), SIP_KERNEL_MAX(-b * dl, -b * du));
+			neg_lb_end[l] += SIP_KERNEL_MAX(0., -a * w);
+			ub_end[l] += SIP_KERNEL_MAX(0., b * w);
+		}
+	}
+	for (int l = 0; i < n; ++i, ++l) {
+		const double a = grad_lb[i];
+		const double b = grad_ub[i];
+		const double dl = -(mid[i] - arg_lb[i]);
+		const double du = arg_ub[i] - mid[i];
+		const double w = arg_ub[i] - arg_lb[i];
+		ub_mid[l] += SIP_KERNEL_MAX(SIP_KERNEL_MAX(a * dl, a * du), SIP_KERNEL_MAX(b * dl, b * du));
+		neg_lb_mid[l] += SIP_KERNEL_MAX(SIP_KERNEL_MAX(-a * dl, -a * du), SIP_KERNEL_MAX(-b * dl, -b * du));
+		neg_lb_end[l] += SIP_KERNEL_MAX(0., -a * w);
+		ub_end[l] += SIP_KERNEL_MAX(0., b * w);
+	}
+	double sum_neg_lb_mid = 0, sum_ub_mid = 0, sum_neg_lb_end = 0, sum_ub_end = 0;
+	for (int l = 0; l < LANES; ++l) {
+		sum_neg_lb_mid += neg_lb_mid[l];
+		sum_ub_mid += ub_mid[l];
+		sum_neg_lb_end += neg_lb_end[l];
+		sum_ub_end += ub_end[l];
+	}
+	neg_lb[0] = sum_neg_lb_mid;
+	ub[0] = sum_ub_mid;
+	neg_lb[1] = sum_neg_lb_end;
+	ub[1] = sum_ub_end;
+	neg_lb[2] = sum_ub_end;
+	ub[2] = sum_neg_lb_end;
+}
+
+} // end anonymous namespace
+
+bool centered_forms_linear_terms(int n, const double* grad_lb, const double* grad_ub,
+		const double* arg_lb, const double* arg_ub, const double* mid, double* res_lb, double* res_ub) {
+	if (!SIP_KERNEL_ROUNDING) {
+		return false;
+	}
+	double neg_lb[3];
+	const int rounding = fegetround();
+	fesetround(FE_UPWARD);
+	linear_terms_upward(n, grad_lb, grad_ub, arg_lb, arg_ub, mid, neg_lb, res_ub);
+	fesetround(rounding);
+	for (int k = 0; k < 3; ++k) {
+		res_lb[k] = -neg_lb[k];
+		if (!std::isfinite(res_lb[k]) || !std::isfinite(res_ub[k])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool centered_forms_linear_terms(const IntervalVector& grad, const IntervalVector& arg, const Vector& mid,
+		Interval res[3]) {
+	if (!SIP_KERNEL_ROUNDING) {
+		return false;
+	}
+	const int n = arg.size();
+	// Buffers are reused between calls (one set per thread)
+	thread_local vector<double> buffer;
+	buffer.resize(5 * n);
+	double* grad_lb = buffer.data();
+	double* grad_ub = grad_lb + n;
+	double* arg_lb = grad_ub + n;
+	double* arg_ub = arg_lb + n;
+	double* center = arg_ub + n;
+	for (int i = 0; i < n; ++i) {
+		if (grad[i].is_unbounded() || arg[i].is_unbounded() || grad[i].is_empty()) {
+			return false;
+		}
+		grad_lb[i] = grad[i].lb();
+		grad_ub[i] = grad[i].ub();
+		arg_lb[i] = arg[i].lb();
+		arg_ub[i] = arg[i].ub();
+		center[i] = mid[i];
+	}
+	double res_lb[3];
+	double res_ub[3];
+	if (!centered_forms_linear_terms(n, grad_lb, grad_ub, arg_lb, arg_ub, center, res_lb, res_ub)) {
+		return false;
+	}
+	for (int k = 0; k < 3; ++k) {
+		res[k] = Interval(res_lb[k], res_ub[k]);
+	}
+	return true;
+}
+
+const char* centered_forms_kernel_isa() {
+	if (!SIP_KERNEL_ROUNDING) {
+		return "none";
+	}
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+	if (__builtin_cpu_supports("avx512f")) {
+		return "avx512f";
+	} else if (__builtin_cpu_supports("avx2")) {
+		return "avx2";
+	}
+#endif
+	return "default";
+}
+
+} // end namespace ibex
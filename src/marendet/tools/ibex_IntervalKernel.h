@@ -0,0 +1,57 @@
+/* ============================================================================
+ * I B E X - ibex_IntervalKernel.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_INTERVALKERNEL_H__
+#define __SIP_IBEX_INTERVALKERNEL_H__
+
+#include "ibex_Interval.h"
+#include "ibex_IntervalVector.h"
+#include "ibex_Vector.h"
+
+namespace ibex {
+
+/**
+ * \brief Linear terms of the centered forms used by centeredFormEval.
+ *
+ * Compute enclosures of grad*(arg-c) for the three centers c = mid,
+ * c = arg.lb() and c = arg.ub(), in one sweep over raw doubles, with the
+ * rounding mode set upward (lower bounds are computed as -(-x), so the
+ * enclosures are rigorous). On x86-64 with GCC, the kernel is compiled for
+ * AVX-512, AVX2 and the baseline ISA, and the version is selected at load
+ * time according to the CPU. With a compiler that cannot guarantee
+ * rounding-math semantics (neither GCC nor -frounding-math), the kernel is
+ * disabled and the function always returns false.
+ *
+ * \param res   - result: res[0] for mid, res[1] for lb, res[2] for ub.
+ * \return false if arg or grad has an infinite bound, or if the kernel is
+ *         disabled. In this case, \a res is not set and interval arithmetic
+ *         must be used instead.
+ */
+bool centered_forms_linear_terms(const IntervalVector& grad, const IntervalVector& arg, const Vector& mid,
+		Interval res[3]);
+
+/**
+ * \brief Raw version of centered_forms_linear_terms.
+ *
+ * All the inputs are assumed finite, with grad_lb<=grad_ub and arg_lb<=mid<=arg_ub.
+ * res_lb and res_ub are arrays of size 3 (mid, lb, ub). Return false if the
+ * result is not finite or if the kernel is disabled.
+ */
+bool centered_forms_linear_terms(int n, const double* grad_lb, const double* grad_ub,
+		const double* arg_lb, const double* arg_ub, const double* mid, double* res_lb, double* res_ub);
+
+/**
+ * \brief Name of the instruction set used by the kernel on this CPU, "none" if it is disabled.
+ */
+const char* centered_forms_kernel_isa();
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_INTERVALKERNEL_H__
@@ -0,0 +1,185 @@
+/* ============================================================================
+ * I B E X - ibex_PavingThreadPool.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_PavingThreadPool.h"
+
+#include "ibex_utils.h"
+
+#include "ibex_Exception.h"
+
+#include <algorithm>
+#include <exception>
+
+using namespace std;
+
+namespace ibex {
+
+const int PavingThreadPool::default_threshold = 256;
+
+thread_local bool PavingThreadPool::in_worker_ = false;
+
+PavingThreadPool& PavingThreadPool::global() {
+	static PavingThreadPool pool;
+	return pool;
+}
+
+PavingThreadPool::PavingThreadPool(int nb_threads) :
+		threshold(default_threshold) {
+	resize(nb_threads);
+}
+
+PavingThreadPool::~PavingThreadPool() {
+	stop_workers();
+	for (auto& copies : replicas_) {
+		for (Function* copy : copies.second) {
+			delete copy;
+		}
+	}
+}
+
+void PavingThreadPool::resize(int nb_threads) {
+	if (nb_threads < 1) {
+		ibex_error("PavingThreadPool: the number of threads must be positive");
+	}
+	stop_workers();
+	for (int t = 1; t < nb_threads; ++t) {
+		Worker* worker = new Worker();
+		worker->thread = std::thread(&PavingThreadPool::run, this, std::ref(*worker));
+		workers_.push_back(worker);
+	}
+}
+
+void PavingThreadPool::stop_workers() {
+	for (Worker* worker : workers_) {
+		{
+			std::lock_guard<std::mutex> lock(worker->mutex);
+			worker->stop = true;
+		}
+		worker->cond.notify_one();
+		worker->thread.join();
+		delete worker;
+	}
+	workers_.clear();
+}
+
+int PavingThreadPool::nb_threads() const {
+	return workers_.size() + 1;
+}
+
+int PavingThreadPool::nb_slots(int size) const {
+	if (nb_threads() == 1 || size < std::max(threshold, 2)) {
+		return 1;
+	}
+	return std::min(nb_threads(), size);
+}
+
+void PavingThreadPool::run(Worker& worker) {
+	in_worker_ = true;
+	while (true) {
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(worker.mutex);
+			worker.cond.wait(lock, [&worker]() {
+				return worker.stop || !worker.tasks.empty();
+			});
+			if (worker.tasks.empty()) {
+				return;
+			}
+			task = std::move(worker.tasks.front());
+			worker.tasks.pop_front();
+		}
+		task();
+	}
+}
+
+void PavingThreadPool::parallel_for(int size, const std::function<void(int, int, int)>& task) {
+	// Nested sweeps would wait for workers busy with their parent sweep
+	const int slots = in_worker_ ? 1 : nb_slots(size);
+	if (slots == 1) {
+		if (size > 0) {
+			task(0, size, 0);
+		}
+		return;
+	}
+	std::mutex mutex;
+	std::condition_variable done;
+	int remaining = slots - 1;
+	std::exception_ptr error;
+	auto chunk_begin = [size, slots](int slot) {
+		return (int) ((long) size * slot / slots);
+	};
+	for (int slot = 1; slot < slots; ++slot) {
+		const int begin = chunk_begin(slot);
+		const int end = chunk_begin(slot + 1);
+		Worker& worker = *workers_[slot - 1];
+		{
+			std::lock_guard<std::mutex> lock(worker.mutex);
+			worker.tasks.emplace_back([&, begin, end, slot]() {
+				std::exception_ptr chunk_error;
+				try {
+					task(begin, end, slot);
+				} catch (...) {
+					chunk_error = std::current_exception();
+				}
+				std::lock_guard<std::mutex> lock(mutex);
+				if (chunk_error && !error) {
+					error = chunk_error;
+				}
+				if (--remaining == 0) {
+					done.notify_one();
+				}
+			});
+		}
+		worker.cond.notify_one();
+	}
+	std::exception_ptr caller_error;
+	try {
+		task(0, chunk_begin(1), 0);
+	} catch (...) {
+		caller_error = std::current_exception();
+	}
+	// The other chunks use the stack of this call: always wait for them
+	std::unique_lock<std::mutex> lock(mutex);
+	done.wait(lock, [&remaining]() {
+		return remaining == 0;
+	});
+	if (caller_error) {
+		std::rethrow_exception(caller_error);
+	}
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
+
+const Function& PavingThreadPool::replica(const Function& function, int slot) {
+	if (slot == 0) {
+		return function;
+	}
+	std::lock_guard<std::mutex> lock(replicas_mutex_);
+	vector<Function*>& copies = replicas_[&function];
+	while ((int) copies.size() < slot) {
+		copies.push_back(copyFunction(function));
+	}
+	return *copies[slot - 1];
+}
+
+void PavingThreadPool::forget(const Function& function) {
+	std::lock_guard<std::mutex> lock(replicas_mutex_);
+	auto it = replicas_.find(&function);
+	if (it == replicas_.end()) {
+		return;
+	}
+	for (Function* copy : it->second) {
+		delete copy;
+	}
+	replicas_.erase(it);
+}
+
+} // end namespace ibex
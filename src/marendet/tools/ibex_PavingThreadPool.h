@@ -0,0 +1,131 @@
+/* ============================================================================
+ * I B E X - ibex_PavingThreadPool.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_PAVINGTHREADPOOL_H__
+#define __SIP_IBEX_PAVINGTHREADPOOL_H__
+
+#include "ibex_Function.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \brief Threads shared by the sweeps over the rows of parameter pavings.
+ *
+ * parallel_for splits the rows of a paving into one chunk per thread. The
+ * calling thread processes the first chunk (slot 0) and the workers of the
+ * pool the other ones (slots 1 to nb_threads()-1). Pavings smaller than
+ * \a threshold are processed by the calling thread alone.
+ *
+ * Ibex functions cannot be evaluated concurrently: the slot 0 uses the
+ * function of the caller, and each other slot its own copy of the function
+ * (see replica). Several threads (e.g. the search threads of SIPOptimizer) can
+ * use the pool at the same time, the chunks of a worker are queued.
+ */
+class PavingThreadPool {
+public:
+	/**
+	 * \brief Default minimal number of rows of a parallel sweep: 256.
+	 */
+	static const int default_threshold;
+
+	/**
+	 * \brief The pool used by the paving sweeps (see ibex_SICPaving.h).
+	 *
+	 * It has a single thread (the caller) until resize is called.
+	 */
+	static PavingThreadPool& global();
+
+	/**
+	 * \brief A pool of \a nb_threads threads, including the calling one.
+	 *
+	 * For tasks other than the paving sweeps (e.g., the concurrent strategies
+	 * of LoupFinderLineSearch). A sweep called from one of its workers is
+	 * sequential, as for the workers of the global pool.
+	 */
+	explicit PavingThreadPool(int nb_threads = 1);
+
+	/**
+	 * \brief Delete *this, after the chunks queued are processed.
+	 */
+	~PavingThreadPool();
+
+	/**
+	 * \brief Set the number of threads, including the calling one.
+	 *
+	 * Must not be called during a sweep.
+	 */
+	void resize(int nb_threads);
+
+	/**
+	 * \brief Number of threads, including the calling one.
+	 */
+	int nb_threads() const;
+
+	/**
+	 * \brief Number of slots used by a sweep over \a size rows: 1 if the sweep is sequential.
+	 */
+	int nb_slots(int size) const;
+
+	/**
+	 * \brief Call task(begin, end, slot) on chunks of [0, size) and wait for all of them.
+	 *
+	 * Exceptions thrown by a chunk are rethrown in the calling thread. A call
+	 * from a worker of the pool is sequential.
+	 */
+	void parallel_for(int size, const std::function<void(int, int, int)>& task);
+
+	/**
+	 * \brief Copy of \a function to use in the slot \a slot (\a function itself for slot 0).
+	 *
+	 * The copies are created by the calling thread, before the sweep.
+	 */
+	const Function& replica(const Function& function, int slot);
+
+	/**
+	 * \brief Delete the copies of \a function. Must be called before \a function is deleted.
+	 */
+	void forget(const Function& function);
+
+	/**
+	 * \brief Minimal number of rows of a parallel sweep.
+	 */
+	int threshold;
+
+private:
+	struct Worker {
+		std::thread thread;
+		std::mutex mutex;
+		std::condition_variable cond;
+		std::deque<std::function<void()>> tasks;
+		bool stop = false;
+	};
+
+	void run(Worker& worker);
+	void stop_workers();
+
+	std::vector<Worker*> workers_;
+
+	std::mutex replicas_mutex_;
+	std::map<const Function*, std::vector<Function*>> replicas_;
+
+	static thread_local bool in_worker_;
+};
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_PAVINGTHREADPOOL_H__
@@ -0,0 +1,163 @@
+/* ============================================================================
+ * I B E X - ibex_SpillFile.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_SpillFile.h"
+
+#include "ibex_Exception.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+const size_t initial_capacity = 1 << 20;
+}
+
+SpillFile::SpillFile(const string& directory) :
+		fd_(-1), map_(nullptr), capacity_(0), end_(0), used_(0) {
+	string dir = directory;
+	if (dir.empty()) {
+		const char* tmpdir = getenv("TMPDIR");
+		dir = (tmpdir != nullptr) ? tmpdir : "/tmp";
+	}
+	string path = dir + "/ibex-sip-spill-XXXXXX";
+	vector<char> name(path.begin(), path.end());
+	name.push_back('\0');
+	fd_ = mkstemp(name.data());
+	if (fd_ < 0) {
+		ibex_error(("SpillFile: cannot create a file in " + dir).c_str());
+	}
+	// The file is removed when it is closed
+	unlink(name.data());
+	reserve(initial_capacity);
+}
+
+SpillFile::~SpillFile() {
+	if (map_ != nullptr) {
+		munmap(map_, capacity_);
+	}
+	close(fd_);
+}
+
+void SpillFile::reserve(size_t capacity) {
+	if (capacity <= capacity_) {
+		return;
+	}
+	if (ftruncate(fd_, capacity) != 0) {
+		ibex_error("SpillFile: cannot extend the file (disk full?)");
+	}
+	if (map_ != nullptr) {
+		munmap(map_, capacity_);
+	}
+	void* map = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+	if (map == MAP_FAILED) {
+		ibex_error("SpillFile: cannot map the file in memory");
+	}
+	map_ = static_cast<char*>(map);
+	capacity_ = capacity;
+}
+
+SpillFile::Extent SpillFile::store(const string& bytes) {
+	Extent extent = { 0, bytes.size() };
+	auto block = free_.lower_bound(bytes.size());
+	if (block != free_.end()) {
+		extent.offset = block->second;
+		const size_t size = block->first;
+		remove_free(extent.offset, size);
+		// The rest of the block stays available
+		if (size > bytes.size()) {
+			add_free(extent.offset + bytes.size(), size - bytes.size());
+		}
+	} else {
+		extent.offset = end_;
+		if (end_ + bytes.size() > capacity_) {
+			reserve(std::max(2 * capacity_, end_ + bytes.size()));
+		}
+		end_ += bytes.size();
+	}
+	memcpy(map_ + extent.offset, bytes.data(), bytes.size());
+	used_ += bytes.size();
+	return extent;
+}
+
+string SpillFile::load(const Extent& extent) const {
+	return string(map_ + extent.offset, extent.size);
+}
+
+void SpillFile::release(const Extent& extent) {
+	used_ -= extent.size;
+	if (used_ == 0) {
+		clear();
+		return;
+	}
+	if (extent.size == 0) {
+		return;
+	}
+	size_t offset = extent.offset;
+	size_t size = extent.size;
+	// Merge with the released blocks just before and just after
+	auto next = free_by_offset_.lower_bound(offset);
+	if (next != free_by_offset_.begin()) {
+		auto previous = std::prev(next);
+		if (previous->first + previous->second == offset) {
+			offset = previous->first;
+			size += previous->second;
+			remove_free(previous->first, previous->second);
+		}
+	}
+	next = free_by_offset_.find(offset + size);
+	if (next != free_by_offset_.end()) {
+		size += next->second;
+		remove_free(next->first, next->second);
+	}
+	if (offset + size == end_) {
+		end_ = offset;
+	} else {
+		add_free(offset, size);
+	}
+}
+
+void SpillFile::add_free(size_t offset, size_t size) {
+	free_.emplace(size, offset);
+	free_by_offset_[offset] = size;
+}
+
+void SpillFile::remove_free(size_t offset, size_t size) {
+	auto range = free_.equal_range(size);
+	for (auto block = range.first; block != range.second; ++block) {
+		if (block->second == offset) {
+			free_.erase(block);
+			break;
+		}
+	}
+	free_by_offset_.erase(offset);
+}
+
+void SpillFile::clear() {
+	free_.clear();
+	free_by_offset_.clear();
+	end_ = 0;
+	used_ = 0;
+	// Give the disk blocks back to the system, the mapping is kept
+	if (ftruncate(fd_, 0) != 0 || ftruncate(fd_, capacity_) != 0) {
+		ibex_error("SpillFile: cannot truncate the file");
+	}
+}
+
+} // end namespace ibex
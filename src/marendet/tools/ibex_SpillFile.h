@@ -0,0 +1,86 @@
+/* ============================================================================
+ * I B E X - ibex_SpillFile.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_SPILLFILE_H__
+#define __SIP_IBEX_SPILLFILE_H__
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace ibex {
+
+/**
+ * \brief Memory-mapped temporary file storing blocks of bytes.
+ *
+ * The file is created in \a directory and removed from it at once: it
+ * disappears with the process. It is mapped in memory and grows by
+ * doubling its size. The space of released blocks is reused (best fit).
+ * Adjacent released blocks are merged, and a released block at the end of
+ * the file is given back to the free space after the last block.
+ */
+class SpillFile {
+public:
+	/**
+	 * \brief A block of the file.
+	 */
+	struct Extent {
+		std::size_t offset;
+		std::size_t size;
+	};
+
+	/**
+	 * \brief Create the file in \a directory (by default, $TMPDIR or /tmp).
+	 */
+	SpillFile(const std::string& directory = "");
+
+	~SpillFile();
+
+	/** \brief Copy \a bytes in a new block and return it. */
+	Extent store(const std::string& bytes);
+
+	/** \brief Return the bytes of the block \a extent. */
+	std::string load(const Extent& extent) const;
+
+	/** \brief Make the space of \a extent available. */
+	void release(const Extent& extent);
+
+	/** \brief Release all the blocks. */
+	void clear();
+
+	/** \brief Number of bytes in the blocks not released. */
+	std::size_t used() const;
+
+private:
+	SpillFile(const SpillFile&);
+	void reserve(std::size_t capacity);
+	void add_free(std::size_t offset, std::size_t size);
+	void remove_free(std::size_t offset, std::size_t size);
+
+	int fd_;
+	char* map_;
+	std::size_t capacity_;
+	/* Bytes after the last block */
+	std::size_t end_;
+	std::size_t used_;
+	/* Released blocks: offsets by size, and sizes by offset */
+	std::multimap<std::size_t, std::size_t> free_;
+	std::map<std::size_t, std::size_t> free_by_offset_;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline std::size_t SpillFile::used() const {
+	return used_;
+}
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_SPILLFILE_H__
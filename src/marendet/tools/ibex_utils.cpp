@@ -11,7 +11,9 @@
  
 #include "ibex_utils.h"
 
+#include "ibex_ExprCopy.h"
 #include "ibex_Interval.h"
+#include "ibex_IntervalKernel.h"
 
 #include <cmath>
 #include <utility>
@@ -50,12 +52,12 @@ double sip_goal_from_ext_box(const Vector& ext_box) {
 	return ext_box[ext_box.size()-1];
 }
 
-Interval centeredFormEval(const Function& function, const IntervalVector& arg) {
+namespace {
+Interval centeredFormWithGradient(const Function& function, const IntervalVector& arg, const IntervalVector& grad) {
 	/*Interval natural_extension = function.eval(arg);
 	Interval centered_form = function.eval(arg.mid()) + function.gradient(arg) * (arg - arg.mid());*/
 	IntervalVector new_arg_ub(arg);
 	IntervalVector new_arg_lb(arg);
-	IntervalVector grad = function.gradient(arg);
 	for(int i = 0; i < arg.size(); ++i) {
 		if(grad[i].lb() > 0) {
 			new_arg_ub[i] = arg[i].ub();
@@ -65,14 +67,40 @@ Interval centeredFormEval(const Function& function, const IntervalVector& arg) {
 			new_arg_lb[i] = arg[i].ub();
 		}
 	}
+	const Vector mid = arg.mid();
 	Interval natural_extension = function.eval(arg);
-	Interval centered_form = function.eval(arg.mid()) + grad * (arg - arg.mid());
-	Interval ub_form = function.eval(arg.ub()) + grad * (arg - arg.ub());
-	Interval lb_form = function.eval(arg.lb()) + grad * (arg - arg.lb());
+	// Linear terms of the centered, lb and ub forms
+	Interval linear_terms[3];
+	if(!centered_forms_linear_terms(grad, arg, mid, linear_terms)) {
+		// Unbounded box or gradient: use interval arithmetic
+		linear_terms[0] = grad * (arg - mid);
+		linear_terms[1] = grad * (arg - arg.lb());
+		linear_terms[2] = grad * (arg - arg.ub());
+	}
+	Interval centered_form = function.eval(mid) + linear_terms[0];
+	Interval lb_form = function.eval(arg.lb()) + linear_terms[1];
+	Interval ub_form = function.eval(arg.ub()) + linear_terms[2];
 	Interval res = natural_extension & centered_form & ub_form & lb_form;
 	res &= Interval(function.eval(new_arg_lb).lb(), function.eval(new_arg_ub).ub());
 	return res;
 }
+}
+
+Interval centeredFormEval(const Function& function, const IntervalVector& arg) {
+	// On a point, all the forms reduce to the natural extension
+	if(arg.is_degenerated()) {
+		return function.eval(arg);
+	}
+	return centeredFormWithGradient(function, arg, function.gradient(arg));
+}
+
+Interval centeredFormEval(const Function& function, const IntervalVector& arg, IntervalVector& grad) {
+	function.gradient(arg, grad);
+	if(arg.is_degenerated()) {
+		return function.eval(arg);
+	}
+	return centeredFormWithGradient(function, arg, grad);
+}
 
 std::string print_mma(const Vector& iv) {
 	std::string res = "{";
@@ -124,4 +152,11 @@ int symbol_array_dim(const Array<const ExprSymbol>& array) {
 	return res;
 }
 
+Function* copyFunction(const Function& function) {
+	Array<const ExprSymbol> args(function.nb_arg());
+	varcopy(function.args(), args);
+	const ExprNode& expr = ExprCopy().copy(function.args(), args, function.expr());
+	return new Function(args, expr);
+}
+
 } // end namespace ibex
@@ -20,6 +20,14 @@
 
 namespace ibex {
 Interval centeredFormEval(const Function& function, const IntervalVector& arg);
+
+/**
+ * \brief Centered form evaluation that also returns the gradient of \a function on \a arg.
+ *
+ * The gradient is computed once and used both for the centered forms and
+ * as output in \a grad (which must have size function.nb_var()).
+ */
+Interval centeredFormEval(const Function& function, const IntervalVector& arg, IntervalVector& grad);
 std::vector<IntervalVector> bisectAllDim(const IntervalVector& iv);
 
 bool isfinite(const Vector& v);
@@ -38,6 +46,12 @@ std::string print_mma(const IntervalVector& iv);
 
 int symbol_array_dim(const Array<const ExprSymbol>& array);
 
+/**
+ * \brief Return a copy of the function with new symbols and a new expression,
+ * so that it does not share any evaluation buffer with the original one.
+ */
+Function* copyFunction(const Function& function);
+
 } // end namespace ibex
 
 #endif // __SIP_IBEX_UTILS_H__
@@ -14,9 +14,11 @@
 
 namespace ibex {
 
-LLP_Factory::LLP_Factory(const MitsosSIP& sip, int c, const Vector& xopt) : new_vars_y(sip.p_arg), x_domain(sip.n_arg),
+LLP_Factory::LLP_Factory(const MitsosSIP& sip, int c, const Vector& xopt, const Function* f) : new_vars_y(sip.p_arg), x_domain(sip.n_arg),
 		 param_LLP_var(sip.p) {
 
+	const Function& ctr_f = f!=NULL ? *f : sip.sys.ctrs[c].f;
+
 	varcopy(sip.params,new_vars_y);
 
 	for (int I=0; I<sip.n_arg; I++) {
@@ -60,7 +62,7 @@ LLP_Factory::LLP_Factory(const MitsosSIP& sip, int c, const Vector& xopt) : new_
 		//ibex_error("cannot build LLP for a parameter-free constraint");
 	}
 
-	const ExprNode& goal_node_tmp=(-sip.sys.ctrs[c].f(new_args));
+	const ExprNode& goal_node_tmp=(-ctr_f(new_args));
 
 	// cleanup ---> in two steps (because of simplify)
 	for (int K=0; K<sip.n_arg+sip.p_arg; K++) {
@@ -75,7 +77,7 @@ LLP_Factory::LLP_Factory(const MitsosSIP& sip, int c, const Vector& xopt) : new_
 
 	// TODO: not the cleanest way!!
 	for (int j=0; j<sip.p; j++) {
-		if (sip.sys.ctrs[c].f.used(sip.varset.param(j))) {
+		if (ctr_f.used(sip.varset.param(j))) {
 			param_LLP_var.add(j);
 		}
 	}
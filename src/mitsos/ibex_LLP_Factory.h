@@ -33,8 +33,10 @@ public:
 	 * \param sip  - The SIP problem
 	 * \param c    - The constraint number (in the original system)
 	 * \param xopt - Either x_LBD or x_UBD
+	 * \param f    - The function of the constraint c, or a copy of it
+	 *               (by default, the function in the original system)
 	 */
-	LLP_Factory(const MitsosSIP& sip, int c, const Vector& xopt);
+	LLP_Factory(const MitsosSIP& sip, int c, const Vector& xopt, const Function* f=NULL);
 
 	virtual ~LLP_Factory();
 
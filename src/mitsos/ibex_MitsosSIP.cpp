@@ -13,15 +13,21 @@
 #include "ibex_BD_Factory.h"
 #include "ibex_LLP_Factory.h"
 #include "ibex_DefaultOptimizer.h"
+#include "ibex_utils.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
 #include <sstream>
+#include <thread>
 
 using namespace std;
 
 namespace ibex {
 
 MitsosSIP::MitsosSIP(System& sys, const Array<const ExprSymbol>& vars, const Array<const ExprSymbol>& params, const BitSet& is_param, bool shared_discretization) :
-			SIP(sys, vars, params, is_param), trace(1), l_max(20), random_seed(0L),
+			SIP(sys, vars, params, is_param), trace(1), l_max(20), random_seed(0L), nb_threads(1),
 			p_domain(p_arg), LBD_samples(new vector<double>[p]),
 			UBD_samples(shared_discretization? LBD_samples : new vector<double>[p]),
 			ORA_samples(shared_discretization? LBD_samples : new vector<double>[p]),
@@ -372,56 +378,68 @@ Interval MitsosSIP::solve_LLP(bool LBD, const Vector& x_opt, double eps) {
 	double lb=NEG_INFINITY;
 	double ub=NEG_INFINITY;
 
-	for (int c=0; c<sys.nb_ctr; c++) {
-		try {
-			LLP_Factory lpp_fac(*this,c,x_opt);
-
-			System max_sys(lpp_fac);
-            //cout << max_sys << endl;
-
-			// Mitsos algorithm works with absolute precision
-			DefaultOptimizer o(max_sys,0,eps,
-					NormalizedSystem::default_eps_h,
-					false,true,random_seed);
-
-			//o.anticipated_upper_bounding = false;
-
-			VarSet param_LLP_var(p, lpp_fac.param_LLP_var);
-
-			IntervalVector param_box=param_LLP_var.var_box(param_init_domain);
-
-			//cout << "param box=" << param_box << endl;
-
-			Optimizer::Status status=o.optimize(param_box);
-			//o.report();
-
-			if (status!=Optimizer::SUCCESS) {
-				ibex_error("LLP failed");
-			}
-
-			// Note: LLP is actually min -g_i(x)
-			if (-o.get_uplo()>ub)
-				ub=-o.get_uplo();
-
-			if (-o.get_loup()>lb)
-				lb=-o.get_loup();
-
-			if (-o.get_loup()<=0) continue; // satisfied constraint
+	// The LLP problems of the constraints are independent: they are solved
+	// by a bounded number of threads, and merged in the order of the constraints.
+	vector<LLPResult> results(sys.nb_ctr);
+	const int threads=std::max(1,std::min(nb_threads,sys.nb_ctr));
 
-			Vector y_opt=o.get_loup_point().lb().subvector(0,max_sys.nb_var-1);
-			int j2=0;
-			for (int j=0; j<p; j++) {
-				if (lpp_fac.param_LLP_var[j]) {
-					//cout << "param n°" << j << " : add sample value " << y_opt[j2] << endl;
-					if (LBD)
-						LBD_samples[j].push_back(y_opt[j2++]);
-					else
-						UBD_samples[j].push_back(y_opt[j2++]);
+	if (threads==1) {
+		for (int c=0; c<sys.nb_ctr; c++) {
+			solve_LLP(c, sys.ctrs[c].f, x_opt, eps, results[c]);
+		}
+	} else {
+		// Each DefaultOptimizer reseeds ibex's global random generator when it
+		// is built: all the problems are built before the optimizations start,
+		// so that no optimization sees the generator reseeded.
+		// Functions are not reentrant: each LLP uses a copy of the constraint
+		vector<std::unique_ptr<Function> > functions(sys.nb_ctr);
+		vector<LLPProblem> problems(sys.nb_ctr);
+		for (int c=0; c<sys.nb_ctr; c++) {
+			functions[c].reset(copyFunction(sys.ctrs[c].f));
+			build_LLP(c, *functions[c], x_opt, eps, problems[c], results[c]);
+		}
+		std::atomic<int> next_ctr(0);
+		vector<std::exception_ptr> errors(threads);
+		auto worker = [&](int t) {
+			try {
+				for (int c=next_ctr++; c<sys.nb_ctr; c=next_ctr++) {
+					if (!results[c].parameter_free)
+						optimize_LLP(problems[c], results[c]);
 				}
+			} catch(...) {
+				errors[t]=std::current_exception();
 			}
+		};
+		vector<std::thread> workers;
+		for (int t=1; t<threads; t++) {
+			workers.push_back(std::thread(worker,t));
+		}
+		worker(0);
+		for (std::thread& w : workers) {
+			w.join();
+		}
+		for (int t=0; t<threads; t++) {
+			if (errors[t]) std::rethrow_exception(errors[t]);
+		}
+	}
 
-		} catch(LLP_Factory::ParameterFreeConstraint&) {
-
+	for (int c=0; c<sys.nb_ctr; c++) {
+		const LLPResult& res=results[c];
+		if (res.parameter_free) continue;
+
+		// Note: LLP is actually min -g_i(x)
+		if (-res.uplo>ub)
+			ub=-res.uplo;
+
+		if (-res.loup>lb)
+			lb=-res.loup;
+
+		for (size_t k=0; k<res.samples.size(); k++) {
+			//cout << "param n°" << res.samples[k].first << " : add sample value " << res.samples[k].second << endl;
+			if (LBD)
+				LBD_samples[res.samples[k].first].push_back(res.samples[k].second);
+			else
+				UBD_samples[res.samples[k].first].push_back(res.samples[k].second);
 		}
 	}
 
@@ -440,4 +458,68 @@ Interval MitsosSIP::solve_LLP(bool LBD, const Vector& x_opt, double eps) {
 	return Interval(lb,ub);
 }
 
+MitsosSIP::LLPProblem::LLPProblem() : param_box(1) {
+
+}
+
+MitsosSIP::LLPProblem::~LLPProblem() {
+	// Members are deleted in reverse order: the optimizer, the system, then the factory
+}
+
+void MitsosSIP::build_LLP(int c, const Function& f, const Vector& x_opt, double eps, LLPProblem& problem, LLPResult& result) const {
+	try {
+		problem.factory.reset(new LLP_Factory(*this,c,x_opt,&f));
+	} catch(LLP_Factory::ParameterFreeConstraint&) {
+		result.parameter_free=true;
+		return;
+	}
+
+	problem.sys.reset(new System(*problem.factory));
+	//cout << *problem.sys << endl;
+
+	// Mitsos algorithm works with absolute precision
+	problem.optimizer.reset(new DefaultOptimizer(*problem.sys,0,eps,
+			NormalizedSystem::default_eps_h,
+			false,true,random_seed));
+
+	//problem.optimizer->anticipated_upper_bounding = false;
+
+	VarSet param_LLP_var(p, problem.factory->param_LLP_var);
+
+	problem.param_box=param_LLP_var.var_box(param_init_domain);
+
+	//cout << "param box=" << problem.param_box << endl;
+}
+
+void MitsosSIP::optimize_LLP(LLPProblem& problem, LLPResult& result) const {
+	DefaultOptimizer& o=*problem.optimizer;
+
+	Optimizer::Status status=o.optimize(problem.param_box);
+	//o.report();
+
+	if (status!=Optimizer::SUCCESS) {
+		ibex_error("LLP failed");
+	}
+
+	result.uplo=o.get_uplo();
+	result.loup=o.get_loup();
+
+	if (-o.get_loup()<=0) return; // satisfied constraint
+
+	Vector y_opt=o.get_loup_point().lb().subvector(0,problem.sys->nb_var-1);
+	int j2=0;
+	for (int j=0; j<p; j++) {
+		if (problem.factory->param_LLP_var[j]) {
+			result.samples.push_back(std::make_pair(j,y_opt[j2++]));
+		}
+	}
+}
+
+void MitsosSIP::solve_LLP(int c, const Function& f, const Vector& x_opt, double eps, LLPResult& result) const {
+	LLPProblem problem;
+	build_LLP(c, f, x_opt, eps, problem, result);
+	if (!result.parameter_free)
+		optimize_LLP(problem, result);
+}
+
 } // namespace ibex
@@ -14,8 +14,15 @@
 
 #include "ibex_SIP.h"
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace ibex {
 
+class DefaultOptimizer;
+class LLP_Factory;
+
 /**
  * \ingroup sip
  */
@@ -60,6 +67,21 @@ public:
 	 */
 	long random_seed;
 
+	/**
+	 * \brief Number of threads solving the LLP problems of the constraints.
+	 *
+	 * With several threads, the LLP problems are all built first, then
+	 * optimized concurrently. ibex's random generator is global: it is seeded
+	 * with random_seed once before the optimizations (each optimizer reseeds
+	 * it when it is built), and the optimizations then draw from it in any
+	 * order. The enclosures are rigorous and the samples are merged in the
+	 * order of the constraints, but their values may differ from a run with
+	 * a single thread.
+	 *
+	 * By default: 1
+	 */
+	int nb_threads;
+
 protected:
 
 	/**
@@ -116,6 +138,53 @@ protected:
 	 */
 	Interval solve_LLP(bool LBD, const Vector& x_opt, double eps);
 
+	/**
+	 * \brief Result of the LLP problem of one constraint (see solve_LLP).
+	 */
+	struct LLPResult {
+		LLPResult() : parameter_free(false), uplo(NEG_INFINITY), loup(POS_INFINITY) { }
+
+		// True if the constraint has no LLP problem
+		bool parameter_free;
+		// Enclosure of min_y -g_c(x_opt, y)
+		double uplo;
+		double loup;
+		// Sample values (parameter index, maximizer) if the constraint is violated
+		std::vector<std::pair<int,double> > samples;
+	};
+
+	/**
+	 * \brief Solve the LLP problem of the constraint n°c, with "f" its
+	 * function (or a copy of it).
+	 */
+	void solve_LLP(int c, const Function& f, const Vector& x_opt, double eps, LLPResult& result) const;
+
+	/**
+	 * \brief LLP problem of one constraint, built before it is optimized.
+	 */
+	struct LLPProblem {
+		LLPProblem();
+		~LLPProblem();
+
+		std::unique_ptr<LLP_Factory> factory;
+		std::unique_ptr<System> sys;
+		std::unique_ptr<DefaultOptimizer> optimizer;
+		IntervalVector param_box;
+	};
+
+	/**
+	 * \brief Build the LLP problem of the constraint n°c (see solve_LLP).
+	 *
+	 * Set result.parameter_free if there is no problem. "f" must outlive
+	 * the problem.
+	 */
+	void build_LLP(int c, const Function& f, const Vector& x_opt, double eps, LLPProblem& problem, LLPResult& result) const;
+
+	/**
+	 * \brief Optimize an LLP problem built by build_LLP and set its enclosure and samples.
+	 */
+	void optimize_LLP(LLPProblem& problem, LLPResult& result) const;
+
 	friend class BD_Factory;
 	friend class LLP_Factory;
 
@@ -0,0 +1,108 @@
+/* ============================================================================
+ * I B E X - TestCellSerializer.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCellSerializer.h"
+
+#include "ibex_BinarySerializer.h"
+#include "ibex_CellSerializer.h"
+#include "ibex_SIPSystem.h"
+
+#include <memory>
+#include <vector>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+// Root cell of a search with one SIC of two parameters in [0,1]^2
+Cell* root_cell() {
+	auto init_caches = make_shared<vector<SIConstraintCache>>(1, SIConstraintCache(IntervalVector(2, Interval(0, 1))));
+	Cell* root = new Cell(IntervalVector(3, Interval(-1, 1)));
+	BxpNodeData* node_data = new BxpNodeData(init_caches);
+	node_data->init_box = root->box;
+	root->prop.add(node_data);
+	return root;
+}
+
+BxpNodeData& node_data(const Cell& cell) {
+	return *(BxpNodeData*) cell.prop[BxpNodeData::id];
+}
+
+// Bisect the paving of the cell and fill its cached values
+void refine(Cell& cell) {
+	cell.box[0] = Interval(0.25, 0.5);
+	cell.bisected_var = 2;
+	SIConstraintCache& cache = node_data(cell).sic_constraints_caches[0];
+	ParameterPaving& paving = cache.parameter_caches_;
+	paving.bisect(0, 0);
+	paving.set_evaluation(0, Interval(-2, -1));
+	paving.set_evaluation(1, Interval(-1, 3));
+	paving.set_full_gradient(1, IntervalVector(5, Interval(1, 2)));
+	cache.best_blankenship_points_.push_back(Vector(2, 0.75));
+}
+
+// The values set by refine
+void check_refined(const Cell& cell, const Cell& root) {
+	CPPUNIT_ASSERT(cell.box[0] == Interval(0.25, 0.5));
+	CPPUNIT_ASSERT(cell.box[1] == Interval(-1, 1));
+	CPPUNIT_ASSERT(cell.bisected_var == 2);
+	const BxpNodeData& data = node_data(cell);
+	CPPUNIT_ASSERT(data.init_box == root.box);
+	CPPUNIT_ASSERT(data.sic_constraints_caches.size() == 1);
+	const SIConstraintCache& cache = data.sic_constraints_caches[0];
+	const ParameterPaving& paving = cache.parameter_caches_;
+	CPPUNIT_ASSERT(paving.size() == 2);
+	CPPUNIT_ASSERT(paving.parameter(0, 0) == Interval(0, 0.5));
+	CPPUNIT_ASSERT(paving.parameter(1, 0) == Interval(0.5, 1));
+	CPPUNIT_ASSERT(paving.parameter(1, 1) == Interval(0, 1));
+	CPPUNIT_ASSERT(paving.evaluation(0) == Interval(-2, -1));
+	CPPUNIT_ASSERT(paving.evaluation(1) == Interval(-1, 3));
+	CPPUNIT_ASSERT(paving.gradient(1, 4) == Interval(1, 2));
+	CPPUNIT_ASSERT(paving.ancestor_count() == 1);
+	CPPUNIT_ASSERT(paving.parent(0) == 0 && paving.parent(1) == 0);
+	CPPUNIT_ASSERT(paving.ancestor_parameter(0, 0) == Interval(0, 1));
+	CPPUNIT_ASSERT(cache.best_blankenship_points_.size() == 1);
+	CPPUNIT_ASSERT(cache.best_blankenship_points_.front() == Vector(2, 0.75));
+}
+}
+
+void TestCellSerializer::round_trip() {
+	unique_ptr<Cell> root(root_cell());
+	Cell cell(*root);
+	refine(cell);
+
+	BinaryWriter writer;
+	CellSerializer::serialize(writer, cell);
+	BinaryReader reader(writer.data());
+	unique_ptr<Cell> copy(CellSerializer::deserialize(reader, *root));
+	CPPUNIT_ASSERT(reader.at_end());
+	check_refined(*copy, *root);
+	// The prototype is not modified
+	CPPUNIT_ASSERT(node_data(*root).sic_constraints_caches[0].parameter_caches_.size() == 1);
+}
+
+void TestCellSerializer::round_trip_snapshot() {
+	unique_ptr<Cell> root(root_cell());
+	Cell cell(*root);
+	refine(cell);
+
+	// The snapshot keeps the paving as it was when it was taken
+	const CellSerializer::Snapshot snapshot(cell);
+	ParameterPaving& paving = node_data(cell).sic_constraints_caches[0].parameter_caches_;
+	paving.bisect(1, 1);
+	paving.set_evaluation(0, Interval(5, 6));
+
+	BinaryWriter writer;
+	CellSerializer::serialize(writer, snapshot);
+	BinaryReader reader(writer.data());
+	unique_ptr<Cell> copy(CellSerializer::deserialize(reader, *root));
+	CPPUNIT_ASSERT(reader.at_end());
+	check_refined(*copy, *root);
+}
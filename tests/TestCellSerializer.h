@@ -0,0 +1,31 @@
+/* ============================================================================
+ * I B E X - TestCellSerializer.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CELL_SERIALIZER_H__
+#define __TEST_CELL_SERIALIZER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class TestCellSerializer : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCellSerializer);
+	CPPUNIT_TEST(round_trip);
+	CPPUNIT_TEST(round_trip_snapshot);
+	CPPUNIT_TEST_SUITE_END();
+
+	void round_trip();
+	void round_trip_snapshot();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCellSerializer);
+
+#endif // __TEST_CELL_SERIALIZER_H__
@@ -0,0 +1,157 @@
+/* ============================================================================
+ * I B E X - TestCellWorkStealingHeap.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCellWorkStealingHeap.h"
+
+#include "ibex_CellWorkStealingHeap.h"
+#include "ibex_SIPSystem.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+const char* minibex =
+		"Variables\n"
+		"    x1 in [-10, 10];\n"
+		"    x2 in [-10, 10];\n"
+		"    y in [0, 1];\n"
+		"Minimize\n"
+		"    x1^2 + x2^2;\n"
+		"Constraints\n"
+		"    x1*y - x2 <= 0;\n"
+		"end\n";
+
+// System of the problem above, read from a temporary file
+SIPSystem* create_system() {
+	char path[] = "/tmp/ibex-sip-test-XXXXXX";
+	const int fd = mkstemp(path);
+	CPPUNIT_ASSERT(fd >= 0);
+	const string text(minibex);
+	const bool written = write(fd, text.data(), text.size()) == (ssize_t) text.size();
+	close(fd);
+	CPPUNIT_ASSERT(written);
+	SIPSystem* system = new SIPSystem(path, regex("y.*", regex_constants::egrep));
+	remove(path);
+	return system;
+}
+
+// Cell whose objective is in [lb, lb+1]
+Cell* create_cell(const SIPSystem& system, double lb) {
+	IntervalVector box(system.ext_nb_var, Interval(-1, 1));
+	box[system.ext_nb_var - 1] = Interval(lb, lb + 1);
+	return new Cell(box);
+}
+
+double objective_lb(const SIPSystem& system, const Cell& cell) {
+	return cell.box[system.ext_nb_var - 1].lb();
+}
+}
+
+void TestCellWorkStealingHeap::minimum_in_flight() {
+	unique_ptr<SIPSystem> system(create_system());
+	CellWorkStealingHeap heap(*system, 2);
+	heap.attach(0);
+	heap.push(create_cell(*system, 3));
+	heap.push(create_cell(*system, 1));
+	heap.push(create_cell(*system, 2));
+	CPPUNIT_ASSERT(heap.minimum() == 1);
+
+	// The thread of the second heap steals the best cell and keeps it in flight
+	Cell* stolen = nullptr;
+	thread thief([&]() {
+		heap.attach(1);
+		stolen = heap.pop();
+	});
+	thief.join();
+	CPPUNIT_ASSERT(stolen != nullptr);
+	CPPUNIT_ASSERT(objective_lb(*system, *stolen) == 1);
+	CPPUNIT_ASSERT(heap.size() == 2);
+	CPPUNIT_ASSERT(heap.minimum() == 1);
+	CPPUNIT_ASSERT(!heap.idle());
+
+	// Its child is pushed in the second heap before it is released
+	heap.attach(1);
+	heap.push(create_cell(*system, 1.5));
+	heap.release();
+	delete stolen;
+	CPPUNIT_ASSERT(heap.minimum() == 1.5);
+	CPPUNIT_ASSERT(heap.size() == 3);
+
+	heap.contract(1.2);
+	CPPUNIT_ASSERT(heap.empty());
+	CPPUNIT_ASSERT(heap.idle());
+	CPPUNIT_ASSERT(heap.minimum() == POS_INFINITY);
+}
+
+void TestCellWorkStealingHeap::minimum_under_stealing() {
+	unique_ptr<SIPSystem> system(create_system());
+	const int nb_threads = 4;
+	// A cell of objective lb < max_lb has two children of objective lb+1
+	const int max_lb = 8;
+	const int nb_roots = 16;
+	CellWorkStealingHeap heap(*system, nb_threads);
+	heap.rebalance_period = 3;
+
+	// All the roots are in the first heap: the other threads start by stealing
+	heap.attach(0);
+	int expected = 0;
+	for (int lb = 0; lb < nb_roots; ++lb) {
+		heap.push(create_cell(*system, lb));
+		expected += lb < max_lb ? (1 << (max_lb - lb + 1)) - 1 : 1;
+	}
+
+	atomic<int> processed(0);
+	atomic<int> violations(0);
+	vector<thread> threads;
+	for (int t = 0; t < nb_threads; ++t) {
+		threads.emplace_back([&, t]() {
+			heap.attach(t);
+			while (true) {
+				Cell* cell = heap.pop();
+				if (cell == nullptr) {
+					if (heap.idle()) {
+						break;
+					}
+					this_thread::yield();
+					continue;
+				}
+				// The cell in flight is still a lower bound of the heaps
+				const double lb = objective_lb(*system, *cell);
+				if (heap.minimum() > lb) {
+					++violations;
+				}
+				if (lb < max_lb) {
+					heap.push(create_cell(*system, lb + 1));
+					heap.push(create_cell(*system, lb + 1));
+				}
+				delete cell;
+				++processed;
+			}
+		});
+	}
+	for (thread& t : threads) {
+		t.join();
+	}
+	CPPUNIT_ASSERT(violations.load() == 0);
+	CPPUNIT_ASSERT(processed.load() == expected);
+	CPPUNIT_ASSERT(heap.idle());
+	CPPUNIT_ASSERT(heap.minimum() == POS_INFINITY);
+}
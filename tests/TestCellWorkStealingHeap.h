@@ -0,0 +1,31 @@
+/* ============================================================================
+ * I B E X - TestCellWorkStealingHeap.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CELL_WORK_STEALING_HEAP_H__
+#define __TEST_CELL_WORK_STEALING_HEAP_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class TestCellWorkStealingHeap : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCellWorkStealingHeap);
+	CPPUNIT_TEST(minimum_in_flight);
+	CPPUNIT_TEST(minimum_under_stealing);
+	CPPUNIT_TEST_SUITE_END();
+
+	void minimum_in_flight();
+	void minimum_under_stealing();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCellWorkStealingHeap);
+
+#endif // __TEST_CELL_WORK_STEALING_HEAP_H__
@@ -0,0 +1,107 @@
+/* ============================================================================
+ * I B E X - TestParameterPaving.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestParameterPaving.h"
+
+#include "ibex_ParameterPaving.h"
+
+using namespace ibex;
+
+namespace {
+// The paving of a single box [0,1]^dim
+ParameterPaving unit_paving(int dim) {
+	ParameterPaving paving(dim);
+	paving.push_back(IntervalVector(dim, Interval(0, 1)));
+	return paving;
+}
+}
+
+void TestParameterPaving::copy_shares_arena() {
+	ParameterPaving a = unit_paving(2);
+	a.set_evaluation(0, Interval(-1, 2));
+	const ParameterPaving b(a);
+	CPPUNIT_ASSERT(b.size() == 1);
+	CPPUNIT_ASSERT(b.parameter_box(0) == a.parameter_box(0));
+	CPPUNIT_ASSERT(b.evaluation(0) == Interval(-1, 2));
+	CPPUNIT_ASSERT(b.parameter_lb(0) == a.parameter_lb(0));
+}
+
+void TestParameterPaving::write_detaches_copy() {
+	const ParameterPaving a = unit_paving(2);
+	ParameterPaving b(a);
+	b.set_parameter(0, 0, Interval(0.5, 1));
+	b.set_evaluation(0, Interval(3, 4));
+	CPPUNIT_ASSERT(b.parameter_lb(0) != a.parameter_lb(0));
+	CPPUNIT_ASSERT(a.parameter(0, 0) == Interval(0, 1));
+	CPPUNIT_ASSERT(a.evaluation(0).is_empty());
+	CPPUNIT_ASSERT(b.parameter(0, 0) == Interval(0.5, 1));
+	CPPUNIT_ASSERT(b.evaluation(0) == Interval(3, 4));
+}
+
+void TestParameterPaving::push_back_after_copy() {
+	// Both pavings append in the free rows of the shared arena
+	ParameterPaving a = unit_paving(1);
+	a.reserve(8);
+	ParameterPaving b(a);
+	a.push_back(IntervalVector(1, Interval(1, 2)));
+	b.push_back(IntervalVector(1, Interval(2, 3)));
+	CPPUNIT_ASSERT(a.size() == 2);
+	CPPUNIT_ASSERT(b.size() == 2);
+	CPPUNIT_ASSERT(a.parameter(1, 0) == Interval(1, 2));
+	CPPUNIT_ASSERT(b.parameter(1, 0) == Interval(2, 3));
+
+	// Same after a truncation of the copy
+	ParameterPaving c(a);
+	c.truncate(1);
+	c.push_back(IntervalVector(1, Interval(4, 5)));
+	CPPUNIT_ASSERT(a.parameter(1, 0) == Interval(1, 2));
+	CPPUNIT_ASSERT(c.parameter(1, 0) == Interval(4, 5));
+}
+
+void TestParameterPaving::bisect_after_copy() {
+	const ParameterPaving a = unit_paving(2);
+	ParameterPaving b(a);
+	const int j = b.bisect(0, 0);
+	CPPUNIT_ASSERT(j == 1);
+	CPPUNIT_ASSERT(b.size() == 2);
+	CPPUNIT_ASSERT(b.parameter(0, 0) == Interval(0, 0.5));
+	CPPUNIT_ASSERT(b.parameter(1, 0) == Interval(0.5, 1));
+	CPPUNIT_ASSERT(b.ancestor_count() == 1);
+	CPPUNIT_ASSERT(b.parent(0) == 0);
+	CPPUNIT_ASSERT(b.parent(1) == 0);
+	CPPUNIT_ASSERT(b.ancestor_parameter(0, 0) == Interval(0, 1));
+
+	CPPUNIT_ASSERT(a.size() == 1);
+	CPPUNIT_ASSERT(a.parameter(0, 0) == Interval(0, 1));
+	CPPUNIT_ASSERT(a.ancestor_count() == 0);
+	CPPUNIT_ASSERT(a.parent(0) == -1);
+}
+
+void TestParameterPaving::ancestor_table_after_copy() {
+	ParameterPaving a = unit_paving(2);
+	a.bisect(0, 0);
+	const long id = a.ancestor_table_id();
+	ParameterPaving b(a);
+	CPPUNIT_ASSERT(b.ancestor_table_id() == id);
+
+	// A new ancestor in the copy takes a private table
+	b.bisect(1, 1);
+	CPPUNIT_ASSERT(b.ancestor_table_id() != id);
+	CPPUNIT_ASSERT(b.ancestor_count() == 2);
+	CPPUNIT_ASSERT(b.ancestor_parent(1) == 0);
+	CPPUNIT_ASSERT(b.parent(1) == 1);
+	CPPUNIT_ASSERT(b.parent(2) == 1);
+
+	CPPUNIT_ASSERT(a.ancestor_table_id() == id);
+	CPPUNIT_ASSERT(a.ancestor_count() == 1);
+	CPPUNIT_ASSERT(a.size() == 2);
+	CPPUNIT_ASSERT(a.parent(1) == 0);
+	CPPUNIT_ASSERT(a.parameter(1, 1) == Interval(0, 1));
+}
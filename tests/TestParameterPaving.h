@@ -0,0 +1,37 @@
+/* ============================================================================
+ * I B E X - TestParameterPaving.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_PARAMETER_PAVING_H__
+#define __TEST_PARAMETER_PAVING_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class TestParameterPaving : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestParameterPaving);
+	CPPUNIT_TEST(copy_shares_arena);
+	CPPUNIT_TEST(write_detaches_copy);
+	CPPUNIT_TEST(push_back_after_copy);
+	CPPUNIT_TEST(bisect_after_copy);
+	CPPUNIT_TEST(ancestor_table_after_copy);
+	CPPUNIT_TEST_SUITE_END();
+
+	void copy_shares_arena();
+	void write_detaches_copy();
+	void push_back_after_copy();
+	void bisect_after_copy();
+	void ancestor_table_after_copy();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestParameterPaving);
+
+#endif // __TEST_PARAMETER_PAVING_H__
@@ -0,0 +1,104 @@
+/* ============================================================================
+ * I B E X - TestSpillFile.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSpillFile.h"
+
+#include "ibex_SpillFile.h"
+
+#include <string>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+// size bytes, all the values of a byte included
+string block(size_t size, int seed) {
+	string bytes(size, '\0');
+	for (size_t k = 0; k < size; ++k) {
+		bytes[k] = (char) ((k * 31 + seed) % 256);
+	}
+	return bytes;
+}
+}
+
+void TestSpillFile::store_load() {
+	SpillFile file;
+	const string a = block(100, 1);
+	const string b = block(3, 2);
+	const SpillFile::Extent ea = file.store(a);
+	const SpillFile::Extent eb = file.store(b);
+	const SpillFile::Extent empty = file.store("");
+	CPPUNIT_ASSERT(file.used() == a.size() + b.size());
+	CPPUNIT_ASSERT(file.load(ea) == a);
+	CPPUNIT_ASSERT(file.load(eb) == b);
+	CPPUNIT_ASSERT(file.load(empty).empty());
+}
+
+void TestSpillFile::store_load_growth() {
+	// Larger than the initial mapping: the blocks stored before are kept
+	SpillFile file;
+	const string a = block(1000, 3);
+	const string b = block(3 << 20, 4);
+	const SpillFile::Extent ea = file.store(a);
+	const SpillFile::Extent eb = file.store(b);
+	CPPUNIT_ASSERT(file.load(ea) == a);
+	CPPUNIT_ASSERT(file.load(eb) == b);
+}
+
+void TestSpillFile::release_reuse() {
+	SpillFile file;
+	const string a = block(64, 5);
+	const string b = block(128, 6);
+	const string c = block(64, 7);
+	const SpillFile::Extent ea = file.store(a);
+	const SpillFile::Extent eb = file.store(b);
+	const SpillFile::Extent ec = file.store(c);
+	file.release(eb);
+	CPPUNIT_ASSERT(file.used() == a.size() + c.size());
+
+	// The released block is reused, its end stays available
+	const string d = block(100, 8);
+	const SpillFile::Extent ed = file.store(d);
+	CPPUNIT_ASSERT(ed.offset == eb.offset);
+	const string e = block(28, 9);
+	const SpillFile::Extent ee = file.store(e);
+	CPPUNIT_ASSERT(ee.offset == eb.offset + d.size());
+	CPPUNIT_ASSERT(file.load(ea) == a);
+	CPPUNIT_ASSERT(file.load(ec) == c);
+	CPPUNIT_ASSERT(file.load(ed) == d);
+	CPPUNIT_ASSERT(file.load(ee) == e);
+}
+
+void TestSpillFile::release_merge() {
+	SpillFile file;
+	const SpillFile::Extent ea = file.store(block(64, 10));
+	const SpillFile::Extent eb = file.store(block(64, 11));
+	const SpillFile::Extent ec = file.store(block(64, 12));
+	const string d = block(64, 13);
+	const SpillFile::Extent ed = file.store(d);
+
+	// Two adjacent released blocks hold a block of their total size
+	file.release(eb);
+	file.release(ec);
+	const string e = block(128, 14);
+	const SpillFile::Extent ee = file.store(e);
+	CPPUNIT_ASSERT(ee.offset == eb.offset);
+	CPPUNIT_ASSERT(file.load(ee) == e);
+	CPPUNIT_ASSERT(file.load(ed) == d);
+
+	// Releasing everything empties the file
+	file.release(ea);
+	file.release(ed);
+	file.release(ee);
+	CPPUNIT_ASSERT(file.used() == 0);
+	const SpillFile::Extent ef = file.store(d);
+	CPPUNIT_ASSERT(ef.offset == 0);
+	CPPUNIT_ASSERT(file.load(ef) == d);
+}
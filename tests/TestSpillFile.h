@@ -0,0 +1,35 @@
+/* ============================================================================
+ * I B E X - TestSpillFile.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SPILL_FILE_H__
+#define __TEST_SPILL_FILE_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class TestSpillFile : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestSpillFile);
+	CPPUNIT_TEST(store_load);
+	CPPUNIT_TEST(store_load_growth);
+	CPPUNIT_TEST(release_reuse);
+	CPPUNIT_TEST(release_merge);
+	CPPUNIT_TEST_SUITE_END();
+
+	void store_load();
+	void store_load_growth();
+	void release_reuse();
+	void release_merge();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSpillFile);
+
+#endif // __TEST_SPILL_FILE_H__